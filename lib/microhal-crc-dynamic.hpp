@@ -0,0 +1,185 @@
+/**
+ * @license    BSD 3-Clause
+ * @brief      CRC library
+ *
+ * @authors    Pawel Okas
+ *
+ * @copyright Copyright (c) 2021, Pawel Okas
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+ * following conditions are met:
+ *
+ *     1. Redistributions of source code must retain the above copyright notice, this list of conditions and the
+ * following disclaimer.
+ *     2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ * following disclaimer in the documentation and/or other materials provided with the distribution.
+ *     3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote
+ * products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _MICROHAL_CRC_DYNAMIC_H_
+#define _MICROHAL_CRC_DYNAMIC_H_
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <tuple>
+
+#include "microhal-crc.hpp"
+
+namespace microhal {
+
+/**
+ * CRC with parameters known at run time, described by Rocksoft model. Lookup tables are generated on first use of
+ * given (polynomial, width, reflectIn) combination and shared by all DynamicCRC objects with the same parameters.
+ * Data is processed with 256 element table, MSB first when input is not reflected and LSB first otherwise, so no bit
+ * reversal is needed in the loop. Table entries and remainder are uint64_t for every width, so each table takes 2 KB
+ * and narrow CRCs (CRC8, CRC16, CRC32) are slower than compile time CRC with Table256 implementation.
+ * Cached tables are never released, every distinct (polynomial, width, reflectIn) combination used by the program
+ * keeps its 2 KB table until program exit. Don't create DynamicCRC from untrusted, unbounded set of parameters.
+ */
+class DynamicCRC {
+ public:
+    struct Parameters {
+        size_t width;
+        uint64_t polynomial;
+        uint64_t initial = 0;
+        uint64_t xorOut = 0;
+        bool reflectIn = false;
+        bool reflectOut = false;
+    };
+
+    explicit DynamicCRC(const Parameters &parameters) : crc_parameters(parameters), crc_table(table(parameters)) {}
+
+    /**
+     * Creates DynamicCRC with parameters of compile time CRC, ie.: DynamicCRC::from<CRC32<>>()
+     */
+    template <typename CRCType>
+    static DynamicCRC from() {
+        return DynamicCRC({CRCType::polynomialLength(), CRCType::polynomial(), CRCType::initialValue(),
+                           CRCType::xorOutValue(), CRCType::inputReflected(), CRCType::outputReflected()});
+    }
+
+    const Parameters &getParameters() const { return crc_parameters; }
+
+    /**
+     * Lookup table from the cache, the same object is returned for all CRCs with equal polynomial, width and reflectIn.
+     */
+    const std::array<uint64_t, 256> &getTable() const { return *crc_table; }
+
+    uint64_t initialize() const {
+        if (crc_parameters.reflectIn) {
+            return crcDetail::reflect(crc_parameters.initial, crc_parameters.width);
+        }
+        return crc_parameters.initial;
+    }
+
+    uint64_t finalize(uint64_t remainder) const {
+        if (crc_parameters.reflectIn != crc_parameters.reflectOut) {
+            remainder = crcDetail::reflect(remainder, crc_parameters.width);
+        }
+        return remainder ^ crc_parameters.xorOut;
+    }
+
+    /**
+     * Remainder is in LSB first form when input is reflected and in MSB first form otherwise.
+     */
+    uint64_t calculatePartial(uint64_t init, const uint8_t *data, size_t lne) const {
+        const auto &table = *crc_table;
+        if (crc_parameters.reflectIn) {
+            uint64_t result = init;
+            for (size_t byte = 0; byte < lne; byte++) {
+                result = (result >> 8) ^ table[(result ^ data[byte]) & 0xFF];
+            }
+            return result;
+        } else {
+            // remainder is aligned to the most significant bit of uint64_t
+            const size_t shiftToAlign = 64 - crc_parameters.width;
+            uint64_t result = init << shiftToAlign;
+            for (size_t byte = 0; byte < lne; byte++) {
+                result = (result << 8) ^ table[(result >> 56) ^ data[byte]];
+            }
+            return result >> shiftToAlign;
+        }
+    }
+
+    uint64_t calculatePartial(uint64_t init, std::span<const uint8_t> data) const {
+        return calculatePartial(init, data.data(), data.size());
+    }
+
+    uint64_t calculate(const uint8_t *data, size_t lne) const {
+        return finalize(calculatePartial(initialize(), data, lne));
+    }
+
+    uint64_t calculate(std::span<const uint8_t> data) const { return calculate(data.data(), data.size()); }
+
+ private:
+    using Table = std::array<uint64_t, 256>;
+
+    Parameters crc_parameters;
+    const Table *crc_table;
+
+    static const Table *table(const Parameters &parameters) {
+        if (parameters.width == 0 || parameters.width > 64) {
+            throw std::invalid_argument("DynamicCRC width have to be in range 1 to 64.");
+        }
+        const auto widerThanCrc = [&](uint64_t value) { return parameters.width < 64 && (value >> parameters.width); };
+        if (widerThanCrc(parameters.polynomial)) {
+            throw std::invalid_argument("DynamicCRC polynomial is wider than CRC width.");
+        }
+        if (widerThanCrc(parameters.initial)) {
+            throw std::invalid_argument("DynamicCRC initial value is wider than CRC width.");
+        }
+        if (widerThanCrc(parameters.xorOut)) {
+            throw std::invalid_argument("DynamicCRC xorOut value is wider than CRC width.");
+        }
+
+        static std::mutex mutex;
+        static std::map<std::tuple<uint64_t, size_t, bool>, std::unique_ptr<const Table>> cache;
+
+        const std::lock_guard<std::mutex> lock(mutex);
+        auto &entry = cache[{parameters.polynomial, parameters.width, parameters.reflectIn}];
+        if (!entry) {
+            entry = std::make_unique<const Table>(generateTable(parameters));
+        }
+        return entry.get();
+    }
+
+    static Table generateTable(const Parameters &parameters) {
+        Table table{};
+        if (parameters.reflectIn) {
+            const uint64_t polynomial = crcDetail::reflect(parameters.polynomial, parameters.width);
+            for (size_t i = 0; i < 256; i++) {
+                uint64_t crc = i;
+                for (size_t bit = 0; bit < 8; bit++) {
+                    crc = (crc & 0b1) ? (crc >> 1) ^ polynomial : crc >> 1;
+                }
+                table[i] = crc;
+            }
+        } else {
+            const uint64_t polynomial = parameters.polynomial << (64 - parameters.width);
+            for (size_t i = 0; i < 256; i++) {
+                uint64_t crc = uint64_t{i} << 56;
+                for (size_t bit = 0; bit < 8; bit++) {
+                    crc = (crc >> 63) ? (crc << 1) ^ polynomial : crc << 1;
+                }
+                table[i] = crc;
+            }
+        }
+        return table;
+    }
+};
+
+}  // namespace microhal
+
+#endif /* _MICROHAL_CRC_DYNAMIC_H_ */
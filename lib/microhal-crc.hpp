@@ -31,15 +31,55 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <bit>
 #include <cstdint>
+#include <cstring>
 #include <limits>
 #include <span>
+#include <stdexcept>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+#if __has_include(<sys/uio.h>)
+#include <sys/uio.h>
+#endif
+
+#if defined(__STDCPP_THREADS__)
+#include <thread>
+#include <vector>
+#endif
 
 #undef CRC
 
 namespace microhal {
 
-enum class Implementation { BitShift, BitShiftLsb, Table256, Table256Lsb };
+enum class Implementation {
+    BitShift,
+    BitShiftLsb,
+    Table16,
+    Table16Lsb,
+    Table256,
+    Table256Lsb,
+    Slice4,
+    Slice4Lsb,
+    Slice8,
+    Slice8Lsb,
+    Slice16,
+    Slice16Lsb,
+    Braid,
+    BraidLsb,
+    Clmul,
+    Vpclmul,
+    Sse42,
+    Auto
+};
 enum class Properties { ReflectIn = 0b01, ReflectOut = 0b10, None = 0 };
 
 constexpr Properties operator|(Properties a, Properties b) {
@@ -87,6 +127,18 @@ constexpr uint32_t reverseBits(uint32_t x) {
     return ((x >> 16) | (x << 16));
 }
 
+constexpr uint64_t reverseBits(uint64_t x) {
+    return (uint64_t{reverseBits(uint32_t(x))} << 32) | reverseBits(uint32_t(x >> 32));
+}
+
+/**
+ * Reverses order of the lowest len bits of value, used to switch remainder between MSB and LSB representation.
+ */
+template <typename T>
+constexpr T reflect(T value, size_t len) {
+    return T(reverseBits(value) >> (std::numeric_limits<T>::digits - len));
+}
+
 template <typename T>
 constexpr std::array<T, 256> tableGeneratorMSB(T polynomial, size_t polynomialLen) {
     // This function is always run at compile time so we don't need to do
@@ -94,6 +146,7 @@ constexpr std::array<T, 256> tableGeneratorMSB(T polynomial, size_t polynomialLe
     const size_t shiftToAlign8Bit = ((sizeof(T) * 8 - polynomialLen) % 8);
     std::array<T, 256> msbTable{};
     const T polinomialMsbBitSet = 1U << (polynomialLen - 1 + shiftToAlign8Bit);
+    const T alignedMask = maskGen<T>(polynomialLen + shiftToAlign8Bit);
     size_t i = 1;
     do {
         T crc = i;
@@ -105,7 +158,7 @@ constexpr std::array<T, 256> tableGeneratorMSB(T polynomial, size_t polynomialLe
                 crc = crc << 1;
             }
         }
-        msbTable[i] = crc;
+        msbTable[i] = crc & alignedMask;
         i++;
     } while (i < 256);
 
@@ -134,6 +187,193 @@ constexpr std::array<T, 256> tableGeneratorLSB(T polynomial, size_t polynomialLe
     return lsbTable;
 }
 
+/**
+ * Generates 16 element table for algorithm that processes data in 4 bit nibbles, entry i is equal to entry i of table
+ * returned by tableGeneratorMSB.
+ */
+template <typename T>
+constexpr std::array<T, 16> tableGenerator16MSB(T polynomial, size_t polynomialLen) {
+    const size_t shiftToAlign8Bit = ((sizeof(T) * 8 - polynomialLen) % 8);
+    const T polinomialMsbBitSet = T(T{1} << (polynomialLen - 1 + shiftToAlign8Bit));
+    const T alignedMask = maskGen<T>(polynomialLen + shiftToAlign8Bit);
+    std::array<T, 16> msbTable{};
+    for (size_t i = 0; i < 16; i++) {
+        T crc = T(i << (polynomialLen + shiftToAlign8Bit - 4));
+        for (size_t bit = 0; bit < 4; bit++) {
+            if (crc & polinomialMsbBitSet) {
+                crc = T((crc << 1) ^ (polynomial << shiftToAlign8Bit));
+            } else {
+                crc = T(crc << 1);
+            }
+        }
+        msbTable[i] = crc & alignedMask;
+    }
+    return msbTable;
+}
+
+/**
+ * Generates 16 element reflected table for algorithm that processes data in 4 bit nibbles.
+ */
+template <typename T>
+constexpr std::array<T, 16> tableGenerator16LSB(T polynomial, size_t polynomialLen) {
+    std::array<T, 16> lsbTable{};
+    const T mask = maskGen<T>(polynomialLen);
+    for (size_t divident = 0; divident < 16; divident++) {
+        T crc = T(divident);
+        for (size_t bit = 0; bit < 4; bit++) {
+            if (crc & 0b1) {
+                crc = T((crc >> 1) ^ polynomial);
+            } else {
+                crc = T(crc >> 1);
+            }
+        }
+        lsbTable[divident] = crc & mask;
+    }
+    return lsbTable;
+}
+
+/**
+ * Generates tables for slicing-by-N algorithm. Table k contains remainder of 8 bit value followed by k zero bytes, so
+ * table 0 is equal to table returned by tableGeneratorMSB.
+ */
+template <typename T, size_t slices>
+constexpr std::array<std::array<T, 256>, slices> tableGeneratorSliceMSB(T polynomial, size_t polynomialLen) {
+    // This function is always run at compile time so we don't need to do
+    // run time optimization
+    const size_t alignedLen = polynomialLen + ((sizeof(T) * 8 - polynomialLen) % 8);
+    const T alignedMask = maskGen<T>(alignedLen);
+    std::array<std::array<T, 256>, slices> msbTables{};
+    msbTables[0] = tableGeneratorMSB(polynomial, polynomialLen);
+    for (size_t slice = 1; slice < slices; slice++) {
+        for (size_t i = 0; i < 256; i++) {
+            const T previous = msbTables[slice - 1][i];
+            msbTables[slice][i] =
+                T(((previous << 8) & alignedMask) ^ msbTables[0][(previous >> (alignedLen - 8)) & 0xFF]);
+        }
+    }
+
+    return msbTables;
+}
+
+/**
+ * Generates reflected tables for slicing-by-N algorithm, table 0 is equal to table returned by tableGeneratorLSB.
+ */
+template <typename T, size_t slices>
+constexpr std::array<std::array<T, 256>, slices> tableGeneratorSliceLSB(T polynomial, size_t polynomialLen) {
+    // This function is always run at compile time so we don't need to do
+    // run time optimization
+    std::array<std::array<T, 256>, slices> lsbTables{};
+    lsbTables[0] = tableGeneratorLSB(polynomial, polynomialLen);
+    for (size_t slice = 1; slice < slices; slice++) {
+        for (size_t i = 0; i < 256; i++) {
+            const T previous = lsbTables[slice - 1][i];
+            lsbTables[slice][i] = T((previous >> 8) ^ lsbTables[0][previous & 0xFF]);
+        }
+    }
+
+    return lsbTables;
+}
+
+//------------------------------------------------------------------------------
+//      Carry-less (GF(2)) polynomial arithmetic modulo CRC polynomial
+//------------------------------------------------------------------------------
+// Polynomials are stored in MSB first form, the highest coefficient x^polynomialLen of CRC polynomial is implicit.
+
+/**
+ * Multiplies value by x modulo polynomial, value have to be reduced (degree lower than polynomialLen).
+ */
+constexpr uint64_t gf2MultiplyByX(uint64_t value, uint64_t polynomial, size_t polynomialLen) {
+    const uint64_t msbBitSet = uint64_t{1} << (polynomialLen - 1);
+    const uint64_t mask = msbBitSet | (msbBitSet - 1);
+    if (value & msbBitSet) {
+        return ((value << 1) ^ polynomial) & mask;
+    }
+    return (value << 1) & mask;
+}
+
+/**
+ * Returns a * b modulo polynomial, a and b have to be reduced.
+ */
+constexpr uint64_t gf2MultiplyMod(uint64_t a, uint64_t b, uint64_t polynomial, size_t polynomialLen) {
+    uint64_t result = 0;
+    for (size_t bit = polynomialLen; bit > 0; --bit) {
+        result = gf2MultiplyByX(result, polynomial, polynomialLen);
+        if ((b >> (bit - 1)) & 0b1) result ^= a;
+    }
+    return result;
+}
+
+/**
+ * Returns x^n modulo polynomial, calculated by squaring so it takes O(log n) multiplications.
+ */
+constexpr uint64_t gf2XPowMod(uint64_t n, uint64_t polynomial, size_t polynomialLen) {
+    uint64_t result = 1;
+    uint64_t square = gf2MultiplyByX(1, polynomial, polynomialLen);
+    for (; n > 0; n >>= 1) {
+        if (n & 0b1) result = gf2MultiplyMod(result, square, polynomial, polynomialLen);
+        square = gf2MultiplyMod(square, square, polynomial, polynomialLen);
+    }
+    return result;
+}
+
+/**
+ * Returns 1 + base + base^2 + ... + base^(count - 1) modulo polynomial, calculated by doubling number of terms so it
+ * takes O(log count) multiplications.
+ */
+constexpr uint64_t gf2GeometricSum(uint64_t base, uint64_t count, uint64_t polynomial, size_t polynomialLen) {
+    uint64_t sum = 0;
+    uint64_t power = 1;  // base^terms, where terms is number of terms in sum
+    for (size_t bit = 64; bit > 0; --bit) {
+        sum ^= gf2MultiplyMod(sum, power, polynomial, polynomialLen);
+        power = gf2MultiplyMod(power, power, polynomial, polynomialLen);
+        if ((count >> (bit - 1)) & 0b1) {
+            sum = gf2MultiplyMod(sum, base, polynomial, polynomialLen) ^ 1;
+            power = gf2MultiplyMod(power, base, polynomial, polynomialLen);
+        }
+    }
+    return sum;
+}
+
+/**
+ * Returns quotient of x^(2 * polynomialLen) / (x^polynomialLen + polynomial), used by Barrett reduction.
+ */
+constexpr uint64_t gf2BarrettQuotient(uint64_t polynomial, size_t polynomialLen) {
+    const uint64_t msbBitSet = uint64_t{1} << (polynomialLen - 1);
+    uint64_t quotient = 1;
+    uint64_t remainder = polynomial;  // x^polynomialLen reduced modulo polynomial
+    for (size_t bit = 0; bit < polynomialLen; bit++) {
+        quotient <<= 1;
+        if (remainder & msbBitSet) {
+            quotient |= 1;
+            remainder = ((remainder << 1) ^ polynomial) & (msbBitSet | (msbBitSet - 1));
+        } else {
+            remainder = (remainder << 1) & (msbBitSet | (msbBitSet - 1));
+        }
+    }
+    return quotient;
+}
+
+/**
+ * Generates tables that multiply reflected remainder by x^(8 * shiftBytes), that is append shiftBytes zero bytes to the
+ * message. Table k contains shifted value of byte k of remainder, remainder is shifted by xoring one lookup per byte.
+ */
+template <typename T, size_t registerBytes>
+constexpr std::array<std::array<T, 256>, registerBytes> tableGeneratorShiftLSB(T polynomial, size_t polynomialLen,
+                                                                              size_t shiftBytes) {
+    const uint64_t factor = gf2XPowMod(8 * shiftBytes, polynomial, polynomialLen);
+    std::array<std::array<T, 256>, registerBytes> tables{};
+    for (size_t table = 0; table < registerBytes; table++) {
+        for (size_t i = 0; i < 256; i++) {
+            const T value = reflect(T(i << (8 * table)), polynomialLen);
+            tables[table][i] = reflect(T(gf2MultiplyMod(value, factor, polynomial, polynomialLen)), polynomialLen);
+        }
+    }
+    return tables;
+}
+
+static_assert(gf2XPowMod(32, 0x04C11DB7, 32) == 0x04C11DB7);
+static_assert(gf2BarrettQuotient(0x04C11DB7, 32) == 0x104D101DF);
+
 static_assert(reverseBits(uint8_t(0x0F)) == 0xF0);
 static_assert(reverseBits(uint8_t(0x01)) == 0x80);
 static_assert(reverseBits(uint8_t(0x80)) == 0x01);
@@ -162,8 +402,9 @@ constexpr int_fast16_t decodeCoeffitient(std::string_view str) {
         str.remove_prefix(1);                           // remove 'x'
         str.remove_prefix(str.find_first_not_of(' '));  // remove spaces
         if (str[0] == '^') {
-            str.remove_prefix(1);                           // remove '^'
-            str.remove_prefix(str.find_first_not_of(' '));  // remove spaces
+            str.remove_prefix(1);                                                  // remove '^'
+            str.remove_prefix(std::min(str.find_first_not_of(' '), str.size()));  // remove spaces
+            if (str.empty()) return -1;                                            // error, missing exponent
             auto end = str.find_first_not_of("0123456789", 0);
             if (end != str.npos) return -1;  // error
             return int_fast16_t(atoi(str.substr(0, end)));
@@ -217,6 +458,89 @@ struct Polynomial {
 template <Implementation impl, typename ChecksumType, ChecksumType polynomial, size_t len, bool reflectIn>
 class CRCImpl;
 
+/**
+ * Implementations calculate data in bit order of their register form, MSB first in MSB form and LSB first in LSB form.
+ * When input reflection doesn't match register form the implementation of the opposite form is used, so bits of every
+ * byte don't have to be reversed, only remainder is reflected once per call.
+ */
+template <Implementation opposite, typename ChecksumType, ChecksumType polynomial, size_t len, bool reflectIn>
+class OppositeForm {
+    using Opposite = CRCImpl<opposite, ChecksumType, polynomial, len, reflectIn>;
+
+ public:
+    static constexpr ChecksumType calculatePartial(ChecksumType init, const uint8_t *data, size_t lne) {
+        return reflect(Opposite::calculatePartial(reflect(init, len), data, lne), len);
+    }
+
+    static constexpr const auto &table()
+        requires requires { Opposite::table(); }
+    {
+        return Opposite::table();
+    }
+
+    static constexpr const auto &tables()
+        requires requires { Opposite::tables(); }
+    {
+        return Opposite::tables();
+    }
+};
+
+template <typename ChecksumType, ChecksumType polynomial, size_t len>
+class CRCImpl<Implementation::BitShift, ChecksumType, polynomial, len, true>
+    : public OppositeForm<Implementation::BitShiftLsb, ChecksumType, polynomial, len, true> {};
+
+template <typename ChecksumType, ChecksumType polynomial, size_t len>
+class CRCImpl<Implementation::BitShiftLsb, ChecksumType, polynomial, len, false>
+    : public OppositeForm<Implementation::BitShift, ChecksumType, polynomial, len, false> {};
+
+template <typename ChecksumType, ChecksumType polynomial, size_t len>
+class CRCImpl<Implementation::Table16, ChecksumType, polynomial, len, true>
+    : public OppositeForm<Implementation::Table16Lsb, ChecksumType, polynomial, len, true> {};
+
+template <typename ChecksumType, ChecksumType polynomial, size_t len>
+class CRCImpl<Implementation::Table16Lsb, ChecksumType, polynomial, len, false>
+    : public OppositeForm<Implementation::Table16, ChecksumType, polynomial, len, false> {};
+
+template <typename ChecksumType, ChecksumType polynomial, size_t len>
+class CRCImpl<Implementation::Table256, ChecksumType, polynomial, len, true>
+    : public OppositeForm<Implementation::Table256Lsb, ChecksumType, polynomial, len, true> {};
+
+template <typename ChecksumType, ChecksumType polynomial, size_t len>
+class CRCImpl<Implementation::Table256Lsb, ChecksumType, polynomial, len, false>
+    : public OppositeForm<Implementation::Table256, ChecksumType, polynomial, len, false> {};
+
+template <typename ChecksumType, ChecksumType polynomial, size_t len>
+class CRCImpl<Implementation::Slice4, ChecksumType, polynomial, len, true>
+    : public OppositeForm<Implementation::Slice4Lsb, ChecksumType, polynomial, len, true> {};
+
+template <typename ChecksumType, ChecksumType polynomial, size_t len>
+class CRCImpl<Implementation::Slice4Lsb, ChecksumType, polynomial, len, false>
+    : public OppositeForm<Implementation::Slice4, ChecksumType, polynomial, len, false> {};
+
+template <typename ChecksumType, ChecksumType polynomial, size_t len>
+class CRCImpl<Implementation::Slice8, ChecksumType, polynomial, len, true>
+    : public OppositeForm<Implementation::Slice8Lsb, ChecksumType, polynomial, len, true> {};
+
+template <typename ChecksumType, ChecksumType polynomial, size_t len>
+class CRCImpl<Implementation::Slice8Lsb, ChecksumType, polynomial, len, false>
+    : public OppositeForm<Implementation::Slice8, ChecksumType, polynomial, len, false> {};
+
+template <typename ChecksumType, ChecksumType polynomial, size_t len>
+class CRCImpl<Implementation::Slice16, ChecksumType, polynomial, len, true>
+    : public OppositeForm<Implementation::Slice16Lsb, ChecksumType, polynomial, len, true> {};
+
+template <typename ChecksumType, ChecksumType polynomial, size_t len>
+class CRCImpl<Implementation::Slice16Lsb, ChecksumType, polynomial, len, false>
+    : public OppositeForm<Implementation::Slice16, ChecksumType, polynomial, len, false> {};
+
+template <typename ChecksumType, ChecksumType polynomial, size_t len>
+class CRCImpl<Implementation::Braid, ChecksumType, polynomial, len, true>
+    : public OppositeForm<Implementation::BraidLsb, ChecksumType, polynomial, len, true> {};
+
+template <typename ChecksumType, ChecksumType polynomial, size_t len>
+class CRCImpl<Implementation::BraidLsb, ChecksumType, polynomial, len, false>
+    : public OppositeForm<Implementation::Braid, ChecksumType, polynomial, len, false> {};
+
 //------------------------------------------------------------------------------
 //            Bit shift implementation (slow but low footprint)
 //------------------------------------------------------------------------------
@@ -226,24 +550,13 @@ class CRCImpl<Implementation::BitShift, ChecksumType, polynomial, len, reflectIn
     static_assert(std::numeric_limits<ChecksumType>::digits >= len);
 
     static constexpr ChecksumType calculatePartial(ChecksumType init, const uint8_t *data, size_t lne) {
-        ChecksumType remainder = init;
-        if constexpr (reflectIn) {
-            for (size_t byte = 0; byte < lne; byte++) {
-                if constexpr (len <= 8) {
-                    remainder = calculateByte(crcDetail::reverseBits(data[byte]) ^ remainder);
-                } else {
-                    ChecksumType reversedData = ChecksumType(crcDetail::reverseBits(data[byte])) << (len - 8);
-                    remainder = calculateByte(reversedData ^ remainder);
-                }
-            }
-        } else {
-            for (size_t byte = 0; byte < lne; byte++) {
-                if constexpr (len <= 8) {
-                    remainder = calculateByte(data[byte] ^ remainder);
-                } else {
-                    ChecksumType dataTmp = ChecksumType(data[byte]) << (len - 8);
-                    remainder = calculateByte(dataTmp ^ remainder);
-                }
+        ChecksumType remainder = init << ShiftToAlign8Bit;
+        for (size_t byte = 0; byte < lne; byte++) {
+            if constexpr (len <= 8) {
+                remainder = calculateByte(data[byte] ^ remainder);
+            } else {
+                ChecksumType dataTmp = ChecksumType(data[byte]) << (AlignedLen - 8);
+                remainder = calculateByte(dataTmp ^ remainder);
             }
         }
         return remainder >> ShiftToAlign8Bit;
@@ -258,12 +571,14 @@ class CRCImpl<Implementation::BitShift, ChecksumType, polynomial, len, reflectIn
             } else
                 remainder <<= 1;
         }
-        return remainder;
+        return remainder & AlignedMask;
     }
 
     enum : ChecksumType {
         Mask = crcDetail::maskGen<ChecksumType>(len),
         ShiftToAlign8Bit = ((sizeof(ChecksumType) * 8 - len) % 8),
+        AlignedLen = len + ShiftToAlign8Bit,
+        AlignedMask = crcDetail::maskGen<ChecksumType>(AlignedLen),
         Polynomial = polynomial << ShiftToAlign8Bit,
         MSBBitSet = 1U << (len - 1 + ShiftToAlign8Bit)
     };
@@ -276,14 +591,8 @@ class CRCImpl<Implementation::BitShiftLsb, ChecksumType, polynomial, len, reflec
 
     static constexpr ChecksumType calculatePartial(ChecksumType init, const uint8_t *data, size_t lne) {
         ChecksumType remainder = init;
-        if constexpr (reflectIn) {
-            for (size_t byte = 0; byte < lne; byte++) {
-                remainder = calculateByte(data[byte] ^ remainder);
-            }
-        } else {
-            for (size_t byte = 0; byte < lne; byte++) {
-                remainder = calculateByte(crcDetail::reverseBits(data[byte]) ^ remainder);
-            }
+        for (size_t byte = 0; byte < lne; byte++) {
+            remainder = calculateByte(data[byte] ^ remainder);
         }
         return remainder;
     }
@@ -302,11 +611,68 @@ class CRCImpl<Implementation::BitShiftLsb, ChecksumType, polynomial, len, reflec
 
     enum : ChecksumType {
         Mask = crcDetail::maskGen<ChecksumType>(len),
+        Polynomial = crcDetail::reflect(polynomial, len),
+    };
+};
+
+//------------------------------------------------------------------------------
+//      Table with 16 elements implementation (two lookups per byte, low footprint)
+//------------------------------------------------------------------------------
+template <typename ChecksumType, ChecksumType polynomial, size_t len, bool reflectIn>
+class CRCImpl<Implementation::Table16, ChecksumType, polynomial, len, reflectIn> {
+    static_assert(std::numeric_limits<ChecksumType>::digits >= len);
+
+    constexpr static auto crc_table = crcDetail::tableGenerator16MSB(polynomial, len);
+
+ public:
+    static constexpr ChecksumType calculatePartial(ChecksumType init, const uint8_t *data, size_t lne) {
+        auto nibble = [](ChecksumType remainder, uint_fast8_t newData) {
+            const uint_fast8_t index = (newData ^ (remainder >> (AlignedLen - 4))) & 0x0F;
+            return ChecksumType(((remainder << 4) & AlignedMask) ^ crc_table[index]);
+        };
+
+        ChecksumType result = init << ShiftToAlign8Bit;
+        for (size_t byte = 0; byte < lne; byte++) {
+            result = nibble(nibble(result, data[byte] >> 4), data[byte]);
+        }
+
+        return result >> ShiftToAlign8Bit;
+    }
+
+    static constexpr const auto &table() { return crc_table; }
+
+ private:
+    enum : ChecksumType {
         ShiftToAlign8Bit = ((sizeof(ChecksumType) * 8 - len) % 8),
-        Polynomial = crcDetail::reverseBits(ChecksumType(polynomial << ShiftToAlign8Bit)),
+        AlignedLen = len + ShiftToAlign8Bit,
+        AlignedMask = crcDetail::maskGen<ChecksumType>(AlignedLen),
     };
 };
 
+template <typename ChecksumType, ChecksumType polynomial, size_t len, bool reflectIn>
+class CRCImpl<Implementation::Table16Lsb, ChecksumType, polynomial, len, reflectIn> {
+    static_assert(std::numeric_limits<ChecksumType>::digits >= len);
+
+    constexpr static auto crc_table = crcDetail::tableGenerator16LSB(crcDetail::reflect(polynomial, len), len);
+
+ public:
+    static constexpr ChecksumType calculatePartial(ChecksumType init, const uint8_t *data, size_t lne) {
+        auto nibble = [](ChecksumType remainder, uint_fast8_t newData) {
+            const uint_fast8_t index = (newData ^ remainder) & 0x0F;
+            return ChecksumType((remainder >> 4) ^ crc_table[index]);
+        };
+
+        ChecksumType result = init;
+        for (size_t byte = 0; byte < lne; byte++) {
+            result = nibble(nibble(result, data[byte]), data[byte] >> 4);
+        }
+
+        return result;
+    }
+
+    static constexpr const auto &table() { return crc_table; }
+};
+
 //------------------------------------------------------------------------------
 //      Table with 256 elements implementation (fast but high footprint)
 //------------------------------------------------------------------------------
@@ -319,30 +685,31 @@ class CRCImpl<Implementation::Table256, ChecksumType, polynomial, len, reflectIn
  public:
     static constexpr ChecksumType calculatePartial(ChecksumType init, const uint8_t *data, size_t lne) {
         auto tableIndex = [](ChecksumType remainder, uint8_t newData) {
-            if constexpr (reflectIn) {
-                newData = crcDetail::reverseBits(newData);
-            }
             if constexpr (len <= 8) {
                 const uint_fast8_t index = newData ^ remainder;
                 return index;
             } else {
-                const uint_fast8_t index = (newData ^ (remainder >> (len - 8))) & 0xFF;
+                const uint_fast8_t index = (newData ^ (remainder >> (AlignedLen - 8))) & 0xFF;
                 return index;
             }
         };
 
-        ChecksumType result = init;
+        ChecksumType result = init << ShiftToAlign8Bit;
         for (size_t byte = 0; byte < lne; byte++) {
-            result = (result << 8) ^ crc_table[tableIndex(result, data[byte])];
+            result = ((result << 8) & AlignedMask) ^ crc_table[tableIndex(result, data[byte])];
         }
 
         return result >> ShiftToAlign8Bit;
     }
 
+    static constexpr const auto &table() { return crc_table; }
+
  private:
     enum : ChecksumType {
         Mask = crcDetail::maskGen<ChecksumType>(len),
         ShiftToAlign8Bit = ((sizeof(ChecksumType) * 8 - len) % 8),
+        AlignedLen = len + ShiftToAlign8Bit,
+        AlignedMask = crcDetail::maskGen<ChecksumType>(AlignedLen),
     };
 };
 //------------------------------------------------------------------------------
@@ -352,15 +719,11 @@ template <typename ChecksumType, ChecksumType polynomial, size_t len, bool refle
 class CRCImpl<Implementation::Table256Lsb, ChecksumType, polynomial, len, reflectIn> {
     static_assert(std::numeric_limits<ChecksumType>::digits >= len);
 
-    constexpr static auto crc_table = crcDetail::tableGeneratorLSB(
-        crcDetail::reverseBits(ChecksumType(polynomial << ((sizeof(ChecksumType) * 8 - len) % 8))), len);
+    constexpr static auto crc_table = crcDetail::tableGeneratorLSB(crcDetail::reflect(polynomial, len), len);
 
  public:
     static constexpr ChecksumType calculatePartial(ChecksumType init, const uint8_t *data, size_t lne) {
         auto tableIndex = [](ChecksumType remainder, uint8_t newData) {
-            if constexpr (!reflectIn) {
-                newData = crcDetail::reverseBits(newData);
-            }
             const uint_fast8_t index = newData ^ (remainder & 0xFFU);
             return index;
         };
@@ -373,6 +736,8 @@ class CRCImpl<Implementation::Table256Lsb, ChecksumType, polynomial, len, reflec
         return result;
     }
 
+    static constexpr const auto &table() { return crc_table; }
+
  private:
     enum : ChecksumType {
         Mask = crcDetail::maskGen<ChecksumType>(len),
@@ -380,62 +745,1642 @@ class CRCImpl<Implementation::Table256Lsb, ChecksumType, polynomial, len, reflec
     };
 };
 
-}  // namespace crcDetail
+//------------------------------------------------------------------------------
+//   Slicing-by-N implementation, N bytes per step (fastest, highest footprint)
+//------------------------------------------------------------------------------
+template <typename ChecksumType, ChecksumType polynomial, size_t len, bool reflectIn, size_t slices>
+class SlicingMSB {
+    static_assert(std::numeric_limits<ChecksumType>::digits >= len);
+    static_assert(slices >= sizeof(ChecksumType));
 
-template <Implementation implementation, typename ChecksumType, crcDetail::Polynomial poly, ChecksumType initial = 0,
-          ChecksumType xorOut = 0, Properties properties = Properties::None>
-class CRC : public crcDetail::CRCImpl<implementation, ChecksumType, poly.polynomial, poly.length,
-                                      (properties & Properties::ReflectIn) == Properties::ReflectIn> {
-    using Base = crcDetail::CRCImpl<implementation, ChecksumType, poly.polynomial, poly.length,
-                                    (properties & Properties::ReflectIn) == Properties::ReflectIn>;
-    static_assert(poly.length > 0, "Incorrect polynomial string format.");
-    static_assert(std::numeric_limits<ChecksumType>::digits >= poly.length);
+    constexpr static auto crc_tables = crcDetail::tableGeneratorSliceMSB<ChecksumType, slices>(polynomial, len);
 
-    static constexpr bool isMsbImplementation() {
-        return implementation == Implementation::BitShift || implementation == Implementation::Table256;
+ public:
+    static constexpr ChecksumType calculatePartial(ChecksumType init, const uint8_t *data, size_t lne) {
+        ChecksumType result = init << ShiftToAlign8Bit;
+        size_t byte = 0;
+        for (; byte + slices <= lne; byte += slices) {
+            result = [&]<size_t... slice>(std::index_sequence<slice...>) {
+                return ChecksumType((sliceLookup<slice>(result, data[byte + slice]) ^ ...));
+            }(std::make_index_sequence<slices>{});
+        }
+        for (; byte < lne; byte++) {
+            result = ((result << 8) & AlignedMask) ^ sliceLookup<0, 0>(result, data[byte]);
+        }
+
+        return result >> ShiftToAlign8Bit;
     }
 
- public:
-    static constexpr ChecksumType polynomial() { return poly.polynomial; }
-    static constexpr size_t polynomialLength() { return poly.length; }
-    static constexpr ChecksumType initialValue() { return initial; }
-    static constexpr bool inputReflected() { return (properties & Properties::ReflectIn) == Properties::ReflectIn; }
-    static constexpr bool outputReflected() { return (properties & Properties::ReflectOut) == Properties::ReflectOut; }
+    static constexpr const auto &tables() { return crc_tables; }
 
-    static constexpr ChecksumType initialize() {
-        if constexpr (isMsbImplementation()) {
-            return initial;
-        } else {
-            return crcDetail::reverseBits(initial);
+ private:
+    // Looks up remainder contribution of byte at position 'slice' of slices long block. Bytes that overlap with
+    // remainder are xored with it before lookup.
+    template <size_t slice, size_t table = slices - 1 - slice>
+    static constexpr ChecksumType sliceLookup(ChecksumType remainder, uint8_t newData) {
+        uint_fast8_t index = newData;
+        if constexpr (slice < RegisterBytes) {
+            index ^= (remainder >> (AlignedLen - 8 - 8 * slice)) & 0xFF;
         }
+        return crc_tables[table][index];
     }
 
-    static constexpr ChecksumType finalize(ChecksumType remainder) {
-        if constexpr (outputReflected() == isMsbImplementation()) {
-            remainder = crcDetail::reverseBits(remainder) >> ShiftToAlign8Bit;
+    enum : ChecksumType {
+        ShiftToAlign8Bit = ((sizeof(ChecksumType) * 8 - len) % 8),
+        AlignedLen = len + ShiftToAlign8Bit,
+        AlignedMask = crcDetail::maskGen<ChecksumType>(AlignedLen),
+        RegisterBytes = AlignedLen / 8,
+    };
+};
+
+template <typename ChecksumType, ChecksumType polynomial, size_t len, bool reflectIn, size_t slices>
+class SlicingLSB {
+    static_assert(std::numeric_limits<ChecksumType>::digits >= len);
+    static_assert(slices >= sizeof(ChecksumType));
+
+    constexpr static auto crc_tables =
+        crcDetail::tableGeneratorSliceLSB<ChecksumType, slices>(crcDetail::reflect(polynomial, len), len);
+
+ public:
+    static constexpr ChecksumType calculatePartial(ChecksumType init, const uint8_t *data, size_t lne) {
+        ChecksumType result = init;
+        size_t byte = 0;
+        for (; byte + slices <= lne; byte += slices) {
+            result = [&]<size_t... slice>(std::index_sequence<slice...>) {
+                return ChecksumType((sliceLookup<slice>(result, data[byte + slice]) ^ ...));
+            }(std::make_index_sequence<slices>{});
+        }
+        for (; byte < lne; byte++) {
+            result = (result >> 8) ^ sliceLookup<0, 0>(result, data[byte]);
         }
 
-        return remainder ^ xorOut;
+        return result;
     }
 
-    static constexpr ChecksumType calculate(const uint8_t *data, size_t lne) {
-        ChecksumType remainder = CRC::calculatePartial(initialize(), data, lne);
-        return finalize(remainder);
-    }
+    static constexpr const auto &tables() { return crc_tables; }
 
-    static constexpr ChecksumType calculate(std::span<const uint8_t> data) {
-        ChecksumType remainder = CRC::calculatePartial(initialize(), data.data(), data.size());
-        return finalize(remainder);
+ private:
+    template <size_t slice, size_t table = slices - 1 - slice>
+    static constexpr ChecksumType sliceLookup(ChecksumType remainder, uint8_t newData) {
+        uint_fast8_t index = newData;
+        if constexpr (slice < RegisterBytes) {
+            index ^= (remainder >> (8 * slice)) & 0xFF;
+        }
+        return crc_tables[table][index];
     }
 
-    using Base::calculatePartial;
+    enum : ChecksumType {
+        RegisterBytes = (len + 7) / 8,
+    };
+};
 
-    static constexpr ChecksumType calculatePartial(ChecksumType init, const std::span<const uint8_t> data) {
-        return CRC::calculatePartial(init, data.data(), data.size());
-    }
+template <typename ChecksumType, ChecksumType polynomial, size_t len, bool reflectIn>
+class CRCImpl<Implementation::Slice4, ChecksumType, polynomial, len, reflectIn>
+    : public SlicingMSB<ChecksumType, polynomial, len, reflectIn, 4> {};
 
- private:
-    enum { ShiftToAlign8Bit = (std::numeric_limits<ChecksumType>::digits - poly.length) % 8 };
+template <typename ChecksumType, ChecksumType polynomial, size_t len, bool reflectIn>
+class CRCImpl<Implementation::Slice4Lsb, ChecksumType, polynomial, len, reflectIn>
+    : public SlicingLSB<ChecksumType, polynomial, len, reflectIn, 4> {};
+
+template <typename ChecksumType, ChecksumType polynomial, size_t len, bool reflectIn>
+class CRCImpl<Implementation::Slice8, ChecksumType, polynomial, len, reflectIn>
+    : public SlicingMSB<ChecksumType, polynomial, len, reflectIn, 8> {};
+
+template <typename ChecksumType, ChecksumType polynomial, size_t len, bool reflectIn>
+class CRCImpl<Implementation::Slice8Lsb, ChecksumType, polynomial, len, reflectIn>
+    : public SlicingLSB<ChecksumType, polynomial, len, reflectIn, 8> {};
+
+template <typename ChecksumType, ChecksumType polynomial, size_t len, bool reflectIn>
+class CRCImpl<Implementation::Slice16, ChecksumType, polynomial, len, reflectIn>
+    : public SlicingMSB<ChecksumType, polynomial, len, reflectIn, 16> {};
+
+template <typename ChecksumType, ChecksumType polynomial, size_t len, bool reflectIn>
+class CRCImpl<Implementation::Slice16Lsb, ChecksumType, polynomial, len, reflectIn>
+    : public SlicingLSB<ChecksumType, polynomial, len, reflectIn, 16> {};
+
+//------------------------------------------------------------------------------
+//   Fixed length implementation, fully unrolled slicing for data of compile time size
+//------------------------------------------------------------------------------
+/**
+ * Calculates data which length N is known at compile time without any loop or tail handling. Data is split into blocks
+ * of width bytes and the rest into blocks of decreasing powers of two, every block is one step of slicing-by-N that
+ * uses the first tables of the table set. Part of remainder that isn't consumed by a block shorter than remainder is
+ * shifted. Tables are taken from Tables implementation in register form matching msb, so no table is added to the
+ * binary: tables() of slicing implementation or table() of 256 element table implementation, which limits width to 1.
+ */
+template <typename ChecksumType, size_t len, bool msb, size_t width, typename Tables>
+class FixedLength {
+    static_assert(std::numeric_limits<ChecksumType>::digits >= len);
+    static_assert(std::has_single_bit(width));
+
+ public:
+    template <size_t N>
+    static constexpr ChecksumType calculatePartial(ChecksumType init, const uint8_t *data) {
+        ChecksumType result = ChecksumType(init << ShiftToAlign8Bit);
+        [&]<size_t... block>(std::index_sequence<block...>) {
+            ((result = calculateBlock<width>(result, data + block * width)), ...);
+        }(std::make_index_sequence<N / width>{});
+        result = calculateTail<N % width>(result, data + N / width * width);
+        return ChecksumType(result >> ShiftToAlign8Bit);
+    }
+
+ private:
+    template <size_t rest>
+    static constexpr ChecksumType calculateTail(ChecksumType remainder, const uint8_t *data) {
+        if constexpr (rest == 0) {
+            return remainder;
+        } else {
+            constexpr size_t block = std::bit_floor(rest);
+            return calculateTail<rest - block>(calculateBlock<block>(remainder, data), data + block);
+        }
+    }
+
+    template <size_t blockWidth>
+    static constexpr ChecksumType calculateBlock(ChecksumType remainder, const uint8_t *data) {
+        return [&]<size_t... slice>(std::index_sequence<slice...>) {
+            return ChecksumType(unconsumed<blockWidth>(remainder) ^
+                                (lookup<slice, blockWidth - 1 - slice>(remainder, data[slice]) ^ ...));
+        }(std::make_index_sequence<blockWidth>{});
+    }
+
+    template <size_t blockWidth>
+    static constexpr ChecksumType unconsumed(ChecksumType remainder) {
+        if constexpr (blockWidth >= RegisterBytes) {
+            return 0;
+        } else if constexpr (msb) {
+            return ChecksumType((remainder << (8 * blockWidth)) & AlignedMask);
+        } else {
+            return ChecksumType(remainder >> (8 * blockWidth));
+        }
+    }
+
+    template <size_t slice, size_t table>
+    static constexpr ChecksumType lookup(ChecksumType remainder, uint8_t newData) {
+        uint_fast8_t index = newData;
+        if constexpr (slice < RegisterBytes) {
+            if constexpr (msb) {
+                index ^= (remainder >> (AlignedLen - 8 - 8 * slice)) & 0xFF;
+            } else {
+                index ^= (remainder >> (8 * slice)) & 0xFF;
+            }
+        }
+        if constexpr (requires { Tables::tables(); }) {
+            return Tables::tables()[table][index];
+        } else {
+            return Tables::table()[index];
+        }
+    }
+
+    static constexpr size_t ShiftToAlign8Bit = msb ? (std::numeric_limits<ChecksumType>::digits - len) % 8 : 0;
+    static constexpr size_t AlignedLen = len + ShiftToAlign8Bit;
+    static constexpr ChecksumType AlignedMask = maskGen<ChecksumType>(AlignedLen);
+    static constexpr size_t RegisterBytes = (AlignedLen + 7) / 8;
+};
+
+//------------------------------------------------------------------------------
+//   Braided implementation, 64 bit words without ISA extensions (zlib style)
+//------------------------------------------------------------------------------
+/**
+ * Processes data in 64 bit words split into Braids interleaved streams, word j of every block belongs to braid j.
+ * Remainder of every braid is calculated independently with tables that shift a byte over the whole block, and it is
+ * xored into the next word of the same braid, so the braids are merged only after the last block. Words are read in
+ * order that puts the first byte where remainder is: little endian for LSB form, big endian for MSB form, so the same
+ * code works on every endianness. Unaligned head of the data and the tail are calculated with 256 element table, so
+ * messages shorter than a few hundred bytes are faster with slicing implementations.
+ */
+template <typename ChecksumType, ChecksumType polynomial, size_t len, bool reflectIn, bool msb>
+class Braided {
+    static_assert(std::numeric_limits<ChecksumType>::digits >= len);
+    static_assert(std::numeric_limits<ChecksumType>::digits <= 64);
+
+    static constexpr size_t Braids = 5;
+    static constexpr size_t WordBytes = sizeof(uint64_t);
+    static constexpr size_t BlockBytes = Braids * WordBytes;
+
+    using Table = CRCImpl<msb ? Implementation::Table256 : Implementation::Table256Lsb, ChecksumType, polynomial, len,
+                          reflectIn>;
+
+    // braid_tables[k][i] is remainder of byte i at position k of a word followed by the rest of the block
+    static constexpr auto braid_tables = [] {
+        const auto slices = msb ? tableGeneratorSliceMSB<ChecksumType, BlockBytes>(polynomial, len)
+                                : tableGeneratorSliceLSB<ChecksumType, BlockBytes>(reflect(polynomial, len), len);
+        std::array<std::array<ChecksumType, 256>, WordBytes> tables{};
+        for (size_t k = 0; k < WordBytes; k++) {
+            tables[k] = slices[BlockBytes - 1 - k];
+        }
+        return tables;
+    }();
+
+ public:
+    static constexpr ChecksumType calculatePartial(ChecksumType init, const uint8_t *data, size_t lne) {
+        if (!std::is_constant_evaluated()) {
+            const size_t misalignment = reinterpret_cast<uintptr_t>(data) % WordBytes;
+            const size_t head = std::min(lne, (WordBytes - misalignment) % WordBytes);
+            init = Table::calculatePartial(init, data, head);
+            data += head;
+            lne -= head;
+        }
+        const size_t blocks = lne / BlockBytes;
+        if (blocks > 0) {
+            std::array<ChecksumType, Braids> remainder{};
+            remainder[0] = init;
+            for (size_t block = 1; block < blocks; block++, data += BlockBytes) {
+                [&]<size_t... braid>(std::index_sequence<braid...>) {
+                    const std::array<uint64_t, Braids> words = {
+                        (load(data + braid * WordBytes) ^ toWord(remainder[braid]))...};
+                    ((remainder[braid] = lookup(words[braid])), ...);
+                }(std::make_index_sequence<Braids>{});
+            }
+            // remainders of braids are xored into the last block that is calculated byte by byte
+            ChecksumType result = 0;
+            for (size_t braid = 0; braid < Braids; braid++) {
+                const auto bytes = store(load(data + braid * WordBytes) ^ toWord(remainder[braid]));
+                result = Table::calculatePartial(result, bytes.data(), bytes.size());
+            }
+            init = result;
+            data += BlockBytes;
+            lne -= blocks * BlockBytes;
+        }
+        return Table::calculatePartial(init, data, lne);
+    }
+
+ private:
+    static constexpr bool loadLittleEndian = !msb;
+    static constexpr bool reverseBytes = (std::endian::native == std::endian::little) != loadLittleEndian;
+
+    static constexpr uint64_t load(const uint8_t *data) {
+        std::array<uint8_t, WordBytes> bytes{};
+        std::copy_n(data, WordBytes, bytes.begin());
+        uint64_t word = std::bit_cast<uint64_t>(bytes);
+        if constexpr (reverseBytes) {
+            word = byteSwap(word);
+        }
+        return word;
+    }
+
+    // Inverse of load, returns bytes in memory order.
+    static constexpr std::array<uint8_t, WordBytes> store(uint64_t word) {
+        if constexpr (reverseBytes) {
+            word = byteSwap(word);
+        }
+        return std::bit_cast<std::array<uint8_t, WordBytes>>(word);
+    }
+
+    static constexpr uint64_t byteSwap(uint64_t word) {
+        word = ((word >> 8) & 0x00FF00FF00FF00FF) | ((word & 0x00FF00FF00FF00FF) << 8);
+        word = ((word >> 16) & 0x0000FFFF0000FFFF) | ((word & 0x0000FFFF0000FFFF) << 16);
+        return (word >> 32) | (word << 32);
+    }
+
+    // Moves remainder to word bytes that it overlaps with.
+    static constexpr uint64_t toWord(ChecksumType remainder) {
+        if constexpr (msb) {
+            return (uint64_t{remainder} << ShiftToAlign8Bit) << (64 - AlignedLen);
+        } else {
+            return remainder;
+        }
+    }
+
+    static constexpr ChecksumType lookup(uint64_t word) {
+        return [&]<size_t... k>(std::index_sequence<k...>) {
+            if constexpr (msb) {
+                return ChecksumType((braid_tables[k][(word >> (56 - 8 * k)) & 0xFF] ^ ...) >> ShiftToAlign8Bit);
+            } else {
+                return ChecksumType((braid_tables[k][(word >> (8 * k)) & 0xFF] ^ ...));
+            }
+        }(std::make_index_sequence<WordBytes>{});
+    }
+
+    static constexpr size_t ShiftToAlign8Bit = msb ? (std::numeric_limits<ChecksumType>::digits - len) % 8 : 0;
+    static constexpr size_t AlignedLen = len + ShiftToAlign8Bit;
+};
+
+template <typename ChecksumType, ChecksumType polynomial, size_t len, bool reflectIn>
+class CRCImpl<Implementation::Braid, ChecksumType, polynomial, len, reflectIn>
+    : public Braided<ChecksumType, polynomial, len, reflectIn, true> {};
+
+template <typename ChecksumType, ChecksumType polynomial, size_t len, bool reflectIn>
+class CRCImpl<Implementation::BraidLsb, ChecksumType, polynomial, len, reflectIn>
+    : public Braided<ChecksumType, polynomial, len, reflectIn, false> {};
+
+//------------------------------------------------------------------------------
+// Carry-less multiplication folding implementations (x86-64 with PCLMULQDQ/VPCLMULQDQ)
+//------------------------------------------------------------------------------
+#if defined(__x86_64__)
+/**
+ * Folds 16 byte blocks with carry-less multiplication and reduces the result with Barrett reduction. CRC of any width
+ * is calculated as 32 bit CRC with polynomial P(x) * x^(32 - len), its remainder is equal to remainder of the original
+ * CRC multiplied by x^(32 - len), so the same 32 bit constants serve every polynomial. When reflected is set data is
+ * processed LSB first and remainder is in LSB form, otherwise both are MSB first.
+ */
+template <typename ChecksumType, ChecksumType polynomial, size_t len, bool reflected>
+class ClmulFolding {
+ protected:
+    static constexpr uint64_t Polynomial32 = uint64_t{polynomial} << (32 - len);
+
+    // Returns constant representing x^n modulo polynomial in form used by carry-less multiplication. For reflected
+    // data multiplication of two reflected values adds one to the power of x, so x^(n-1) is used.
+    static constexpr uint64_t constant(size_t n) {
+        if constexpr (reflected) {
+            return uint64_t{reverseBits(uint32_t(gf2XPowMod(n - 1, Polynomial32, 32)))} << 32;
+        } else {
+            return gf2XPowMod(n, Polynomial32, 32);
+        }
+    }
+
+    // Returns 33 bit value with x^32 coefficient set, reflected when data is reflected.
+    static constexpr uint64_t barrettConstant(uint64_t value) {
+        if constexpr (reflected) {
+            return (uint64_t{reverseBits(uint32_t(value))} << 1) | 0b1;
+        } else {
+            return value | (uint64_t{1} << 32);
+        }
+    }
+
+    // Keys for folding 128 bit block over distance bits, low quadword of keys multiplies low quadword of the block.
+    static constexpr std::array<uint64_t, 2> foldKeys(size_t distance) {
+        if constexpr (reflected) {
+            return {constant(distance + 64), constant(distance)};
+        } else {
+            return {constant(distance), constant(distance + 64)};
+        }
+    }
+
+    static constexpr std::array<uint64_t, 2> Fold512 = foldKeys(512);
+    static constexpr std::array<uint64_t, 2> Fold128 = foldKeys(128);
+    static constexpr std::array<uint64_t, 2> Reduction = {constant(96), constant(64)};
+    static constexpr std::array<uint64_t, 2> Barrett = {barrettConstant(gf2BarrettQuotient(Polynomial32, 32)),
+                                                        barrettConstant(Polynomial32)};
+
+ public:
+    /**
+     * Calculates remainder of data, lne has to be multiple of 16 and not lower than 16.
+     */
+    __attribute__((target("pclmul,ssse3"))) static ChecksumType calculateBlocks(ChecksumType remainder,
+                                                                                 const uint8_t *data, size_t lne) {
+        __m128i x0 = _mm_xor_si128(load(data), initialBlock(remainder));
+        data += 16;
+        lne -= 16;
+        if (lne >= 48) {
+            __m128i x1 = load(data);
+            __m128i x2 = load(data + 16);
+            __m128i x3 = load(data + 32);
+            data += 48;
+            lne -= 48;
+            const __m128i fold512 = keys(Fold512);
+            for (; lne >= 64; data += 64, lne -= 64) {
+                x0 = fold(x0, load(data), fold512);
+                x1 = fold(x1, load(data + 16), fold512);
+                x2 = fold(x2, load(data + 32), fold512);
+                x3 = fold(x3, load(data + 48), fold512);
+            }
+            const __m128i fold128 = keys(Fold128);
+            x1 = fold(x0, x1, fold128);
+            x2 = fold(x1, x2, fold128);
+            x0 = fold(x2, x3, fold128);
+        }
+        const __m128i fold128 = keys(Fold128);
+        for (; lne >= 16; data += 16, lne -= 16) {
+            x0 = fold(x0, load(data), fold128);
+        }
+        return reduce(x0);
+    }
+
+    __attribute__((target("pclmul,ssse3"))) static __m128i load(const uint8_t *data) {
+        const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data));
+        if constexpr (reflected) {
+            return block;
+        } else {
+            return _mm_shuffle_epi8(block, _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15));
+        }
+    }
+
+    __attribute__((target("pclmul,ssse3"))) static __m128i initialBlock(ChecksumType remainder) {
+        if constexpr (reflected) {
+            return _mm_cvtsi32_si128(static_cast<int>(remainder));
+        } else {
+            return _mm_slli_si128(_mm_cvtsi32_si128(static_cast<int>(uint32_t{remainder} << (32 - len))), 12);
+        }
+    }
+
+    __attribute__((target("pclmul,ssse3"))) static __m128i keys(const std::array<uint64_t, 2> &keys) {
+        return _mm_set_epi64x(static_cast<long long>(keys[1]), static_cast<long long>(keys[0]));
+    }
+
+    __attribute__((target("pclmul,ssse3"))) static __m128i fold(__m128i block, __m128i next, __m128i keys) {
+        return _mm_xor_si128(
+            _mm_xor_si128(_mm_clmulepi64_si128(block, keys, 0x00), _mm_clmulepi64_si128(block, keys, 0x11)), next);
+    }
+
+    /**
+     * Returns remainder of block multiplied by x^32.
+     */
+    __attribute__((target("pclmul,ssse3"))) static ChecksumType reduce(__m128i block) {
+        const __m128i reduction = keys(Reduction);
+        const __m128i barrett = keys(Barrett);
+        if constexpr (reflected) {
+            // high powers of x are in low quadword: block * x^32 = low * x^96 + high * x^32
+            __m128i value = _mm_xor_si128(_mm_clmulepi64_si128(block, reduction, 0x00),
+                                          _mm_slli_si128(_mm_srli_si128(block, 8), 4));
+            // value has degree lower than 96, fold its 32 highest coefficients into 64 bit value
+            value = _mm_xor_si128(_mm_clmulepi64_si128(value, reduction, 0x10),
+                                  _mm_slli_si128(_mm_srli_si128(value, 8), 8));
+            value = _mm_srli_si128(value, 8);
+            const __m128i mask = _mm_set_epi32(0, 0, 0, -1);
+            __m128i quotient = _mm_clmulepi64_si128(_mm_and_si128(value, mask), barrett, 0x00);
+            quotient = _mm_clmulepi64_si128(_mm_and_si128(quotient, mask), barrett, 0x10);
+            return ChecksumType(uint32_t(_mm_cvtsi128_si32(_mm_srli_si128(_mm_xor_si128(value, quotient), 4))));
+        } else {
+            // block * x^32 = high * x^96 + low * x^32
+            __m128i value = _mm_xor_si128(_mm_clmulepi64_si128(block, reduction, 0x01),
+                                          _mm_srli_si128(_mm_slli_si128(block, 8), 4));
+            // value has degree lower than 96, fold its 32 highest coefficients into 64 bit value
+            value = _mm_xor_si128(_mm_clmulepi64_si128(value, reduction, 0x11), _mm_move_epi64(value));
+            __m128i quotient = _mm_clmulepi64_si128(_mm_srli_epi64(value, 32), barrett, 0x00);
+            quotient = _mm_clmulepi64_si128(_mm_srli_epi64(quotient, 32), barrett, 0x10);
+            return ChecksumType(uint32_t(_mm_cvtsi128_si32(_mm_xor_si128(value, quotient))) >> (32 - len));
+        }
+    }
+};
+
+template <typename ChecksumType, ChecksumType polynomial, size_t len, bool reflectIn>
+class CRCImpl<Implementation::Clmul, ChecksumType, polynomial, len, reflectIn> {
+    static_assert(std::numeric_limits<ChecksumType>::digits >= len);
+    static_assert(len <= 32, "Clmul implementation supports polynomials up to 32 bits.");
+
+    using Table = CRCImpl<Implementation::Table256, ChecksumType, polynomial, len, reflectIn>;
+    using Folding = ClmulFolding<ChecksumType, polynomial, len, reflectIn>;
+
+ public:
+    static constexpr ChecksumType calculatePartial(ChecksumType init, const uint8_t *data, size_t lne) {
+        if (std::is_constant_evaluated() || lne < 16) {
+            return Table::calculatePartial(init, data, lne);
+        }
+        const size_t foldedLength = lne & ~size_t{0x0F};
+        ChecksumType remainder;
+        if constexpr (reflectIn) {
+            remainder = reflect(Folding::calculateBlocks(reflect(init, len), data, foldedLength), len);
+        } else {
+            remainder = Folding::calculateBlocks(init, data, foldedLength);
+        }
+        return Table::calculatePartial(remainder, data + foldedLength, lne - foldedLength);
+    }
+
+    // Table that calculates messages shorter than 16 bytes and bytes after the last folded block.
+    static constexpr const auto &table() { return Table::table(); }
+};
+
+/**
+ * Extends carry-less multiplication folding with 512 bit registers, every instruction folds four 128 bit lanes. Long
+ * messages are folded 256 bytes per iteration in four independent registers, shorter messages and the last blocks use
+ * 128 bit folding.
+ */
+template <typename ChecksumType, ChecksumType polynomial, size_t len, bool reflected>
+class VpclmulFolding : public ClmulFolding<ChecksumType, polynomial, len, reflected> {
+    using Base = ClmulFolding<ChecksumType, polynomial, len, reflected>;
+
+    static constexpr std::array<uint64_t, 2> Fold2048 = Base::foldKeys(2048);
+    static constexpr std::array<uint64_t, 2> Fold512 = Base::foldKeys(512);
+    static constexpr std::array<uint64_t, 2> Fold384 = Base::foldKeys(384);
+    static constexpr std::array<uint64_t, 2> Fold256 = Base::foldKeys(256);
+    static constexpr std::array<uint64_t, 2> Fold128 = Base::foldKeys(128);
+
+ public:
+    /**
+     * Calculates remainder of data, lne has to be multiple of 16 and not lower than 16.
+     */
+    __attribute__((target("avx512f,avx512bw,vpclmulqdq,pclmul,ssse3"))) static ChecksumType calculateBlocks(
+        ChecksumType remainder, const uint8_t *data, size_t lne) {
+        if (lne < 256) {
+            return Base::calculateBlocks(remainder, data, lne);
+        }
+        __m512i z0 = _mm512_xor_si512(load(data), _mm512_zextsi128_si512(Base::initialBlock(remainder)));
+        __m512i z1 = load(data + 64);
+        __m512i z2 = load(data + 128);
+        __m512i z3 = load(data + 192);
+        data += 256;
+        lne -= 256;
+        const __m512i fold2048 = keys(Fold2048);
+        for (; lne >= 256; data += 256, lne -= 256) {
+            z0 = fold(z0, load(data), fold2048);
+            z1 = fold(z1, load(data + 64), fold2048);
+            z2 = fold(z2, load(data + 128), fold2048);
+            z3 = fold(z3, load(data + 192), fold2048);
+        }
+        const __m512i fold512 = keys(Fold512);
+        z1 = fold(z0, z1, fold512);
+        z2 = fold(z1, z2, fold512);
+        z0 = fold(z2, z3, fold512);
+        for (; lne >= 64; data += 64, lne -= 64) {
+            z0 = fold(z0, load(data), fold512);
+        }
+        // fold four lanes of the register into one 128 bit block
+        __m128i x0 = lane<3>(z0);
+        x0 = Base::fold(lane<2>(z0), x0, Base::keys(Fold128));
+        x0 = Base::fold(lane<1>(z0), x0, Base::keys(Fold256));
+        x0 = Base::fold(lane<0>(z0), x0, Base::keys(Fold384));
+
+        const __m128i fold128 = Base::keys(Fold128);
+        for (; lne >= 16; data += 16, lne -= 16) {
+            x0 = Base::fold(x0, Base::load(data), fold128);
+        }
+        return Base::reduce(x0);
+    }
+
+ private:
+    __attribute__((target("avx512f,avx512bw,vpclmulqdq,pclmul,ssse3"))) static __m512i load(const uint8_t *data) {
+        const __m512i block = _mm512_loadu_si512(data);
+        if constexpr (reflected) {
+            return block;
+        } else {
+            const __m512i reverse = _mm512_set4_epi64(0x0001020304050607, 0x08090A0B0C0D0E0F, 0x0001020304050607,
+                                                      0x08090A0B0C0D0E0F);
+            return _mm512_shuffle_epi8(block, reverse);
+        }
+    }
+
+    template <int index>
+    __attribute__((target("avx512f,avx512bw,vpclmulqdq,pclmul,ssse3"))) static __m128i lane(__m512i block) {
+        return _mm512_maskz_extracti32x4_epi32(0x0F, block, index);
+    }
+
+    __attribute__((target("avx512f,avx512bw,vpclmulqdq,pclmul,ssse3"))) static __m512i keys(
+        const std::array<uint64_t, 2> &keys) {
+        return _mm512_set4_epi64(static_cast<long long>(keys[1]), static_cast<long long>(keys[0]),
+                                 static_cast<long long>(keys[1]), static_cast<long long>(keys[0]));
+    }
+
+    __attribute__((target("avx512f,avx512bw,vpclmulqdq,pclmul,ssse3"))) static __m512i fold(__m512i block, __m512i next,
+                                                                                            __m512i keys) {
+        return _mm512_ternarylogic_epi64(_mm512_clmulepi64_epi128(block, keys, 0x00),
+                                         _mm512_clmulepi64_epi128(block, keys, 0x11), next, 0x96);
+    }
+};
+
+template <typename ChecksumType, ChecksumType polynomial, size_t len, bool reflectIn>
+class CRCImpl<Implementation::Vpclmul, ChecksumType, polynomial, len, reflectIn> {
+    static_assert(std::numeric_limits<ChecksumType>::digits >= len);
+    static_assert(len <= 32, "Vpclmul implementation supports polynomials up to 32 bits.");
+
+    using Table = CRCImpl<Implementation::Table256, ChecksumType, polynomial, len, reflectIn>;
+    using Folding = VpclmulFolding<ChecksumType, polynomial, len, reflectIn>;
+
+ public:
+    static constexpr ChecksumType calculatePartial(ChecksumType init, const uint8_t *data, size_t lne) {
+        if (std::is_constant_evaluated() || lne < 16) {
+            return Table::calculatePartial(init, data, lne);
+        }
+        const size_t foldedLength = lne & ~size_t{0x0F};
+        ChecksumType remainder;
+        if constexpr (reflectIn) {
+            remainder = reflect(Folding::calculateBlocks(reflect(init, len), data, foldedLength), len);
+        } else {
+            remainder = Folding::calculateBlocks(init, data, foldedLength);
+        }
+        return Table::calculatePartial(remainder, data + foldedLength, lne - foldedLength);
+    }
+
+    // Table that calculates messages shorter than 16 bytes and bytes after the last folded block.
+    static constexpr const auto &table() { return Table::table(); }
+};
+
+//------------------------------------------------------------------------------
+//   CRC32 instruction implementation (x86-64 with SSE4.2, CRC32C polynomial)
+//------------------------------------------------------------------------------
+/**
+ * Calculates CRC32C with crc32 instruction. The instruction has 3 cycles latency and 1 cycle throughput so buffer is
+ * split into three interleaved streams that are calculated independently and merged with table based shift. Other
+ * polynomials are calculated with Slice8Lsb implementation.
+ */
+template <typename ChecksumType, ChecksumType polynomial, size_t len, bool reflectIn>
+class CRCImpl<Implementation::Sse42, ChecksumType, polynomial, len, reflectIn> {
+    static_assert(std::numeric_limits<ChecksumType>::digits >= len);
+
+    using Fallback = CRCImpl<Implementation::Slice8Lsb, ChecksumType, polynomial, len, reflectIn>;
+    static constexpr bool hardwareSupported = len == 32 && polynomial == 0x1EDC6F41 && reflectIn;
+
+    static constexpr size_t LongBlock = 8192;
+    static constexpr size_t ShortBlock = 256;
+
+    template <size_t block>
+    static constexpr auto shift_tables = crcDetail::tableGeneratorShiftLSB<uint32_t, 4>(0x1EDC6F41, 32, block);
+
+ public:
+    static constexpr ChecksumType calculatePartial(ChecksumType init, const uint8_t *data, size_t lne) {
+        if constexpr (hardwareSupported) {
+            if (!std::is_constant_evaluated()) {
+                return ChecksumType(calculateHardware(init, data, lne));
+            }
+        }
+        return Fallback::calculatePartial(init, data, lne);
+    }
+
+    // Tables of Slice8Lsb implementation that calculates polynomials other than CRC32C.
+    static constexpr const auto &tables()
+        requires(!hardwareSupported)
+    {
+        return Fallback::tables();
+    }
+
+ private:
+    __attribute__((target("sse4.2"))) static uint32_t calculateHardware(uint32_t init, const uint8_t *data,
+                                                                         size_t lne) {
+        uint64_t result = init;
+        for (; lne >= 3 * LongBlock; data += 3 * LongBlock, lne -= 3 * LongBlock) {
+            result = calculateStreams<LongBlock>(result, data);
+        }
+        for (; lne >= 3 * ShortBlock; data += 3 * ShortBlock, lne -= 3 * ShortBlock) {
+            result = calculateStreams<ShortBlock>(result, data);
+        }
+        for (; lne >= 8; data += 8, lne -= 8) {
+            result = _mm_crc32_u64(result, load(data));
+        }
+        uint32_t remainder = uint32_t(result);
+        for (; lne > 0; data++, lne--) {
+            remainder = _mm_crc32_u8(remainder, *data);
+        }
+        return remainder;
+    }
+
+    // Calculates three consecutive blocks in parallel, remainder of first block is shifted over two following blocks.
+    template <size_t block>
+    __attribute__((target("sse4.2"))) static uint64_t calculateStreams(uint64_t remainder, const uint8_t *data) {
+        uint64_t remainder1 = 0;
+        uint64_t remainder2 = 0;
+        for (size_t i = 0; i < block; i += 8) {
+            remainder = _mm_crc32_u64(remainder, load(data + i));
+            remainder1 = _mm_crc32_u64(remainder1, load(data + block + i));
+            remainder2 = _mm_crc32_u64(remainder2, load(data + 2 * block + i));
+        }
+        return shift<block>(shift<block>(uint32_t(remainder)) ^ uint32_t(remainder1)) ^ uint32_t(remainder2);
+    }
+
+    template <size_t block>
+    static uint32_t shift(uint32_t remainder) {
+        return shift_tables<block>[0][remainder & 0xFF] ^ shift_tables<block>[1][(remainder >> 8) & 0xFF] ^
+               shift_tables<block>[2][(remainder >> 16) & 0xFF] ^ shift_tables<block>[3][remainder >> 24];
+    }
+
+    static uint64_t load(const uint8_t *data) {
+        uint64_t value;
+        std::memcpy(&value, data, sizeof(value));
+        return value;
+    }
+};
+#else
+template <typename ChecksumType, ChecksumType polynomial, size_t len, bool reflectIn>
+class CRCImpl<Implementation::Sse42, ChecksumType, polynomial, len, reflectIn> {
+    static_assert(len == 0, "Sse42 implementation is available only on x86-64 architecture.");
+};
+
+template <typename ChecksumType, ChecksumType polynomial, size_t len, bool reflectIn>
+class CRCImpl<Implementation::Clmul, ChecksumType, polynomial, len, reflectIn> {
+    static_assert(len == 0, "Clmul implementation is available only on x86-64 architecture.");
+};
+
+template <typename ChecksumType, ChecksumType polynomial, size_t len, bool reflectIn>
+class CRCImpl<Implementation::Vpclmul, ChecksumType, polynomial, len, reflectIn> {
+    static_assert(len == 0, "Vpclmul implementation is available only on x86-64 architecture.");
+};
+#endif
+
+//------------------------------------------------------------------------------
+//      Runtime selected implementation
+//------------------------------------------------------------------------------
+/**
+ * Selects the fastest implementation supported by CPU on first call, selection is done once per CRC type. Remainder
+ * is in MSB form. Compile time calculation uses Table256 implementation.
+ */
+template <typename ChecksumType, ChecksumType polynomial, size_t len, bool reflectIn>
+class CRCImpl<Implementation::Auto, ChecksumType, polynomial, len, reflectIn> {
+    static_assert(std::numeric_limits<ChecksumType>::digits >= len);
+
+    template <Implementation implementation>
+    using Impl = CRCImpl<implementation, ChecksumType, polynomial, len, reflectIn>;
+    using Kernel = ChecksumType (*)(ChecksumType, const uint8_t *, size_t);
+
+ public:
+    static constexpr ChecksumType calculatePartial(ChecksumType init, const uint8_t *data, size_t lne) {
+        if (std::is_constant_evaluated()) {
+            return Impl<Implementation::Table256>::calculatePartial(init, data, lne);
+        }
+        return kernel.load(std::memory_order_relaxed)(init, data, lne);
+    }
+
+ private:
+    static ChecksumType resolve(ChecksumType init, const uint8_t *data, size_t lne) {
+        const Kernel selected = selectKernel();
+        kernel.store(selected, std::memory_order_relaxed);
+        return selected(init, data, lne);
+    }
+
+    // Points to resolve until the first call replaces it with selected kernel, so later calls don't check any guard.
+    // Pointer is constant initialized and can be used during initialization of other static objects.
+    static inline std::atomic<Kernel> kernel{resolve};
+
+    static Kernel selectKernel() {
+#if defined(__x86_64__)
+        if constexpr (len <= 32) {
+            __builtin_cpu_init();
+            const bool clmul = __builtin_cpu_supports("pclmul") && __builtin_cpu_supports("ssse3");
+            const bool vpclmul = clmul && __builtin_cpu_supports("avx512bw") && __builtin_cpu_supports("vpclmulqdq");
+            if (len == 32 && polynomial == 0x1EDC6F41 && reflectIn && __builtin_cpu_supports("sse4.2")) {
+                return vpclmul ? sse42VpclmulKernel : sse42Kernel;
+            }
+            if (vpclmul) {
+                return Impl<Implementation::Vpclmul>::calculatePartial;
+            }
+            if (clmul) {
+                return Impl<Implementation::Clmul>::calculatePartial;
+            }
+        }
+#endif
+        return Impl<Implementation::Slice8>::calculatePartial;
+    }
+
+#if defined(__x86_64__)
+    // Sse42 implementation keeps remainder in LSB form.
+    static ChecksumType sse42Kernel(ChecksumType init, const uint8_t *data, size_t lne) {
+        const ChecksumType remainder = Impl<Implementation::Sse42>::calculatePartial(reflect(init, len), data, lne);
+        return reflect(remainder, len);
+    }
+
+    // Folding calculates messages shorter than 16 bytes with table and has higher setup cost, so crc32 instruction is
+    // faster for short messages. Vpclmul has higher throughput above the threshold, Clmul never beats crc32 instruction.
+    static constexpr size_t Sse42VpclmulThreshold = 256;
+
+    static ChecksumType sse42VpclmulKernel(ChecksumType init, const uint8_t *data, size_t lne) {
+        if (lne < Sse42VpclmulThreshold) {
+            return sse42Kernel(init, data, lne);
+        }
+        return Impl<Implementation::Vpclmul>::calculatePartial(init, data, lne);
+    }
+#endif
+};
+
+//------------------------------------------------------------------------------
+//      Multi-buffer calculation, many messages processed in lockstep
+//------------------------------------------------------------------------------
+/**
+ * Calculates remainders of many messages, Lockstep::step advances lanes messages by the same number of bytes so table
+ * lookups of different messages don't depend on each other and execute in parallel. Lane that finished its message
+ * takes the next one, so messages of different lengths don't wait for the longest one.
+ */
+template <typename Engine, typename Lockstep, size_t lanes, typename ChecksumType>
+void calculateInterleaved(std::span<const std::span<const uint8_t>> messages, std::span<ChecksumType> remainders,
+                          ChecksumType init) {
+    constexpr size_t Idle = std::numeric_limits<size_t>::max();
+    std::array<const uint8_t *, lanes> data{};
+    std::array<size_t, lanes> left{};
+    std::array<size_t, lanes> message{};
+    std::array<ChecksumType, lanes> remainder{};
+    size_t next = 0;
+
+    auto load = [&](size_t lane) {
+        if (next == messages.size()) {
+            message[lane] = Idle;
+            return false;
+        }
+        data[lane] = messages[next].data();
+        left[lane] = messages[next].size();
+        message[lane] = next;
+        remainder[lane] = init;
+        next++;
+        return true;
+    };
+
+    if (messages.size() >= lanes) {
+        for (size_t lane = 0; lane < lanes; lane++) {
+            load(lane);
+        }
+        bool allLanesBusy = true;
+        while (allLanesBusy) {
+            const size_t step = *std::min_element(left.begin(), left.end());
+            Lockstep::step(remainder, data, step);
+            for (size_t lane = 0; lane < lanes; lane++) {
+                data[lane] += step;
+                left[lane] -= step;
+                if (left[lane] == 0) {
+                    remainders[message[lane]] = remainder[lane];
+                    allLanesBusy = load(lane) && allLanesBusy;
+                }
+            }
+        }
+        // when there is no message for every lane remaining messages are finished one by one
+        for (size_t lane = 0; lane < lanes; lane++) {
+            if (message[lane] != Idle) {
+                remainders[message[lane]] = Engine::calculatePartial(remainder[lane], data[lane], left[lane]);
+            }
+        }
+    }
+    for (; next < messages.size(); next++) {
+        remainders[next] = Engine::calculatePartial(init, messages[next].data(), messages[next].size());
+    }
+}
+
+// number of messages processed in lockstep by scalar code, limited by number of registers
+constexpr size_t BatchLanes = 8;
+
+template <typename Engine, typename ChecksumType, size_t lanes>
+struct ScalarLockstep {
+    static void step(std::array<ChecksumType, lanes> &remainder, const std::array<const uint8_t *, lanes> &data,
+                     size_t lne) {
+        for (size_t byte = 0; byte < lne; byte++) {
+            for (size_t lane = 0; lane < lanes; lane++) {
+                remainder[lane] = Engine::calculatePartial(remainder[lane], data[lane] + byte, 1);
+            }
+        }
+    }
+};
+
+#if defined(__x86_64__)
+/**
+ * Processes 8 lanes of 32 bit remainders in one AVX2 register, table lookups are done with gather instruction. Every
+ * lane reads 4 bytes of its message with gather that addresses messages by offset from the first message, remainder is
+ * kept in MSB form aligned to alignedLen bits or in LSB form.
+ */
+template <typename Engine, typename ChecksumType, bool msb, size_t len>
+struct GatherLockstep {
+    static_assert(sizeof(ChecksumType) == 4);
+
+    __attribute__((target("avx2"))) static void step(std::array<ChecksumType, 8> &remainder,
+                                                     const std::array<const uint8_t *, 8> &data, size_t lne) {
+        // messages are addressed relative to the first one, usually all of them are in one buffer so 32 bit offsets
+        // are enough and one gather loads words of all lanes
+        const uint8_t *base = data[0];
+        std::array<int64_t, 8> offsets;
+        bool nearBase = lne <= size_t{INT32_MAX};
+        for (size_t lane = 0; lane < 8; lane++) {
+            offsets[lane] = int64_t(reinterpret_cast<uintptr_t>(data[lane]) - reinterpret_cast<uintptr_t>(base));
+            nearBase = nearBase && offsets[lane] >= INT32_MIN && offsets[lane] <= INT32_MAX - int64_t(lne);
+        }
+        __m256i crc = _mm256_slli_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(remainder.data())),
+                                        ShiftToAlign8Bit);
+        const size_t words = lne / 4;
+        if (nearBase) {
+            __m256i index = _mm256_setr_epi32(int(offsets[0]), int(offsets[1]), int(offsets[2]), int(offsets[3]),
+                                              int(offsets[4]), int(offsets[5]), int(offsets[6]), int(offsets[7]));
+            const __m256i wordSize = _mm256_set1_epi32(4);
+            for (size_t word = 0; word < words; word++) {
+                crc = calculateWord(crc, _mm256_i32gather_epi32(reinterpret_cast<const int *>(base), index, 1));
+                index = _mm256_add_epi32(index, wordSize);
+            }
+        } else {
+            __m256i index0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(offsets.data()));
+            __m256i index1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(offsets.data() + 4));
+            const __m256i wordSize = _mm256_set1_epi64x(4);
+            for (size_t word = 0; word < words; word++) {
+                const __m256i newData =
+                    _mm256_set_m128i(_mm256_i64gather_epi32(reinterpret_cast<const int *>(base), index1, 1),
+                                     _mm256_i64gather_epi32(reinterpret_cast<const int *>(base), index0, 1));
+                crc = calculateWord(crc, newData);
+                index0 = _mm256_add_epi64(index0, wordSize);
+                index1 = _mm256_add_epi64(index1, wordSize);
+            }
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(remainder.data()), _mm256_srli_epi32(crc, ShiftToAlign8Bit));
+        const size_t byte = words * 4;
+        for (size_t lane = 0; lane < 8; lane++) {
+            remainder[lane] = Engine::calculatePartial(remainder[lane], data[lane] + byte, lne - byte);
+        }
+    }
+
+ private:
+    static constexpr int ShiftToAlign8Bit = msb ? (32 - len) % 8 : 0;
+    static constexpr int AlignedLen = int(len) + ShiftToAlign8Bit;
+
+    __attribute__((target("avx2"))) static __m256i alignedMask() {
+        return _mm256_set1_epi32(int(maskGen<uint32_t>(AlignedLen)));
+    }
+
+    // Calculates 4 bytes of every lane, table lookups of all lanes are done with one gather.
+    __attribute__((target("avx2"))) static __m256i calculateWord(__m256i crc, __m256i words) {
+        const int *table = reinterpret_cast<const int *>(Engine::table().data());
+        const __m256i byteMask = _mm256_set1_epi32(0xFF);
+        for (int shift = 0; shift < 32; shift += 8) {
+            const __m256i newData = _mm256_and_si256(_mm256_srli_epi32(words, shift), byteMask);
+            if constexpr (msb) {
+                const __m256i index = _mm256_xor_si256(_mm256_srli_epi32(crc, AlignedLen - 8), newData);
+                crc = _mm256_xor_si256(_mm256_and_si256(_mm256_slli_epi32(crc, 8), alignedMask()),
+                                       _mm256_i32gather_epi32(table, _mm256_and_si256(index, byteMask), 4));
+            } else {
+                const __m256i index = _mm256_and_si256(_mm256_xor_si256(crc, newData), byteMask);
+                crc = _mm256_xor_si256(_mm256_srli_epi32(crc, 8), _mm256_i32gather_epi32(table, index, 4));
+            }
+        }
+        return crc;
+    }
+};
+#endif
+
+/**
+ * Calculates remainders of messages with Table256 implementation when input is not reflected and with Table256Lsb
+ * otherwise, so bytes don't need bit reversal, remainders are converted when msb form differs. Messages are processed
+ * in lockstep, when CPU supports AVX2 32 bit CRCs use table lookups with gather instruction.
+ */
+template <typename ChecksumType, ChecksumType polynomial, size_t len, bool reflectIn, bool msb>
+void calculateBatch(std::span<const std::span<const uint8_t>> messages, std::span<ChecksumType> remainders,
+                    ChecksumType init) {
+    constexpr bool engineMsb = !reflectIn;
+    using Engine = CRCImpl<engineMsb ? Implementation::Table256 : Implementation::Table256Lsb, ChecksumType, polynomial,
+                           len, reflectIn>;
+    if constexpr (engineMsb != msb) {
+        init = reflect(init, len);
+    }
+    auto interleave = [&] {
+#if defined(__x86_64__)
+        if constexpr (sizeof(ChecksumType) == 4) {
+            static const bool avx2 = __builtin_cpu_supports("avx2");
+            if (avx2) {
+                using Lockstep = GatherLockstep<Engine, ChecksumType, engineMsb, len>;
+                return calculateInterleaved<Engine, Lockstep, 8>(messages, remainders, init);
+            }
+        }
+#endif
+        using Lockstep = ScalarLockstep<Engine, ChecksumType, BatchLanes>;
+        calculateInterleaved<Engine, Lockstep, BatchLanes>(messages, remainders, init);
+    };
+    interleave();
+    if constexpr (engineMsb != msb) {
+        for (auto &remainder : remainders) {
+            remainder = reflect(remainder, len);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+//      Copy functions used by fused copy and calculation
+//------------------------------------------------------------------------------
+/**
+ * Copies data with non-temporal stores that bypass cache, used for large copies when destination won't be read soon
+ * and would only evict useful data from cache. Falls back to memcpy on architectures without streaming stores.
+ */
+inline void copyNonTemporal(uint8_t *destination, const uint8_t *source, size_t lne) {
+#if defined(__x86_64__)
+    // streaming stores require 16 byte aligned destination
+    const size_t head = std::min(lne, (16 - reinterpret_cast<uintptr_t>(destination) % 16) % 16);
+    std::memcpy(destination, source, head);
+    size_t byte = head;
+    for (; byte + 16 <= lne; byte += 16) {
+        const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + byte));
+        _mm_stream_si128(reinterpret_cast<__m128i *>(destination + byte), block);
+    }
+    std::memcpy(destination + byte, source + byte, lne - byte);
+#else
+    std::memcpy(destination, source, lne);
+#endif
+}
+
+inline void storeFence() {
+#if defined(__x86_64__)
+    _mm_sfence();
+#endif
+}
+
+
+}  // namespace crcDetail
+
+template <Implementation implementation, typename ChecksumType, crcDetail::Polynomial poly, ChecksumType initial = 0,
+          ChecksumType xorOut = 0, Properties properties = Properties::None>
+class CRC : public crcDetail::CRCImpl<implementation, ChecksumType, poly.polynomial, poly.length,
+                                      (properties & Properties::ReflectIn) == Properties::ReflectIn> {
+    using Base = crcDetail::CRCImpl<implementation, ChecksumType, poly.polynomial, poly.length,
+                                    (properties & Properties::ReflectIn) == Properties::ReflectIn>;
+    static_assert(poly.length > 0, "Incorrect polynomial string format.");
+    static_assert(std::numeric_limits<ChecksumType>::digits >= poly.length);
+
+    static constexpr bool isMsbImplementation() {
+        return implementation == Implementation::BitShift || implementation == Implementation::Table16 ||
+               implementation == Implementation::Table256 || implementation == Implementation::Slice4 ||
+               implementation == Implementation::Slice8 || implementation == Implementation::Slice16 ||
+               implementation == Implementation::Braid || implementation == Implementation::Clmul ||
+               implementation == Implementation::Vpclmul || implementation == Implementation::Auto;
+    }
+
+    // Implementation in register form matching input reflection which tables are used by fixed length kernel. Tables of
+    // the selected implementation are reused so fixed length calculation doesn't add tables to the binary, Braid uses
+    // its 256 element table. BitShift means there are no suitable tables and fixed length kernel isn't used.
+    static constexpr Implementation fixedLengthTables() {
+        constexpr bool msb = !inputReflected();
+        switch (implementation) {
+            case Implementation::Table256:
+            case Implementation::Table256Lsb:
+            case Implementation::Braid:
+            case Implementation::BraidLsb:
+                return msb ? Implementation::Table256 : Implementation::Table256Lsb;
+            case Implementation::Slice4:
+            case Implementation::Slice4Lsb:
+                return msb ? Implementation::Slice4 : Implementation::Slice4Lsb;
+            case Implementation::Slice8:
+            case Implementation::Slice8Lsb:
+                return msb ? Implementation::Slice8 : Implementation::Slice8Lsb;
+            case Implementation::Slice16:
+            case Implementation::Slice16Lsb:
+                return msb ? Implementation::Slice16 : Implementation::Slice16Lsb;
+            default:
+                return Implementation::BitShift;
+        }
+    }
+
+    // Widest slice of fixed length kernel, equal to number of tables used by fixed length kernel.
+    static constexpr size_t fixedLengthMaxWidth() {
+        switch (fixedLengthTables()) {
+            case Implementation::Table256:
+            case Implementation::Table256Lsb:
+                return 1;
+            case Implementation::Slice4:
+            case Implementation::Slice4Lsb:
+                return 4;
+            case Implementation::Slice8:
+            case Implementation::Slice8Lsb:
+                return 8;
+            case Implementation::Slice16:
+            case Implementation::Slice16Lsb:
+                return 16;
+            default:
+                return 0;
+        }
+    }
+
+    // Converts remainder between form of implementation and register form of fixed length kernel, the conversion is
+    // its own inverse.
+    static constexpr ChecksumType fixedLengthForm(ChecksumType remainder) {
+        if constexpr (isMsbImplementation() == inputReflected()) {
+            return crcDetail::reflect(remainder, poly.length);
+        } else {
+            return remainder;
+        }
+    }
+
+    // Calculates N bytes with fixed length kernel, remainder is in fixed length form.
+    template <size_t N>
+    static constexpr ChecksumType calculateFixedLength(ChecksumType remainder, const uint8_t *data) {
+        constexpr size_t width = std::min(std::bit_floor(N), fixedLengthMaxWidth());
+        using Tables =
+            crcDetail::CRCImpl<fixedLengthTables(), ChecksumType, poly.polynomial, poly.length, inputReflected()>;
+        using Kernel = crcDetail::FixedLength<ChecksumType, poly.length, !inputReflected(), width, Tables>;
+        return Kernel::template calculatePartial<N>(remainder, data);
+    }
+
+    template <typename... CRCTypes>
+    friend class MultiCRC;
+
+ public:
+    static constexpr ChecksumType polynomial() { return poly.polynomial; }
+    static constexpr size_t polynomialLength() { return poly.length; }
+    static constexpr ChecksumType initialValue() { return initial; }
+    static constexpr ChecksumType xorOutValue() { return xorOut; }
+    static constexpr bool inputReflected() { return (properties & Properties::ReflectIn) == Properties::ReflectIn; }
+    static constexpr bool outputReflected() { return (properties & Properties::ReflectOut) == Properties::ReflectOut; }
+
+    static constexpr ChecksumType initialize() {
+        if constexpr (isMsbImplementation()) {
+            return initial;
+        } else {
+            return crcDetail::reflect(initial, poly.length);
+        }
+    }
+
+    static constexpr ChecksumType finalize(ChecksumType remainder) {
+        if constexpr (outputReflected() == isMsbImplementation()) {
+            remainder = crcDetail::reflect(remainder, poly.length);
+        }
+
+        return remainder ^ xorOut;
+    }
+
+    static constexpr ChecksumType calculate(const uint8_t *data, size_t lne) {
+        ChecksumType remainder = CRC::calculatePartial(initialize(), data, lne);
+        return finalize(remainder);
+    }
+
+    static constexpr ChecksumType calculate(std::span<const uint8_t> data) {
+        ChecksumType remainder = CRC::calculatePartial(initialize(), data.data(), data.size());
+        return finalize(remainder);
+    }
+
+    static constexpr size_t FixedLengthUnrollLimit = 64;
+
+    /**
+     * Calculates CRC of data which size is known at compile time, ie. SD card command or CAN frame. Table256, SliceN
+     * and Braid implementations calculate data up to FixedLengthUnrollLimit bytes with fully unrolled kernel without
+     * loops that uses tables of the implementation, slice widths are chosen from N and limited by number of tables.
+     * Table256 and Braid have a single 256 element table, so for them the kernel is an unrolled byte by byte loop,
+     * only SliceN implementations process N bytes per step. Other implementations and longer data are calculated by
+     * the implementation.
+     */
+    template <size_t N>
+    static constexpr ChecksumType calculate(const std::array<uint8_t, N> &data) {
+        return calculate(std::span<const uint8_t, N>(data));
+    }
+
+    template <size_t N>
+        requires(N != std::dynamic_extent)
+    static constexpr ChecksumType calculate(std::span<const uint8_t, N> data) {
+        if constexpr (N > 0 && N <= FixedLengthUnrollLimit && fixedLengthMaxWidth() > 0) {
+            // kernel works in register form matching input reflection, so no bits of data are reversed
+            constexpr bool msb = !inputReflected();
+            ChecksumType remainder =
+                calculateFixedLength<N>(msb ? initial : crcDetail::reflect(initial, poly.length), data.data());
+            if constexpr (outputReflected() == msb) {
+                remainder = crcDetail::reflect(remainder, poly.length);
+            }
+            return remainder ^ xorOut;
+        } else {
+            return calculate(data.data(), N);
+        }
+    }
+
+    using Base::calculatePartial;
+
+    static constexpr ChecksumType calculatePartial(ChecksumType init, const std::span<const uint8_t> data) {
+        return CRC::calculatePartial(init, data.data(), data.size());
+    }
+
+    /**
+     * Calculates remainder of message that is bitCount bits long, ie. CAN FD frame. Whole bytes are calculated by
+     * implementation and only trailing bits are calculated bit by bit. Trailing bits are taken from the last byte in
+     * transmission order, starting from the most significant bit when input isn't reflected and from the least
+     * significant bit otherwise. Throws std::invalid_argument when data is shorter than bitCount bits.
+     */
+    static constexpr ChecksumType calculatePartialBits(ChecksumType init, std::span<const uint8_t> data,
+                                                       uint64_t bitCount) {
+        if (bitCount / 8 + (bitCount % 8 != 0) > data.size()) {
+            throw std::invalid_argument("CRC bit count exceeds data length.");
+        }
+        const size_t bytes = size_t(bitCount / 8);
+        ChecksumType remainder = CRC::calculatePartial(init, data.data(), bytes);
+        const uint8_t trailingByte = bitCount % 8 ? data[bytes] : 0;
+        for (unsigned bit = 0; bit < bitCount % 8; bit++) {
+            const bool dataBit = inputReflected() ? (trailingByte >> bit) & 1 : (trailingByte >> (7 - bit)) & 1;
+            if constexpr (isMsbImplementation()) {
+                const bool msb = ((remainder >> (poly.length - 1)) & 1) != dataBit;
+                remainder = ChecksumType(remainder << 1) & crcDetail::maskGen<ChecksumType>(poly.length);
+                if (msb) remainder ^= poly.polynomial;
+            } else {
+                const bool lsb = (remainder & 1) != dataBit;
+                remainder = ChecksumType(remainder >> 1);
+                if (lsb) remainder ^= crcDetail::reflect(poly.polynomial, poly.length);
+            }
+        }
+        return remainder;
+    }
+
+    static constexpr ChecksumType calculateBits(std::span<const uint8_t> data, uint64_t bitCount) {
+        return finalize(calculatePartialBits(initialize(), data, bitCount));
+    }
+
+    /**
+     * Calculates CRC of message stored in many fragments, ie. header, payload pages and trailer. Fragments shorter than
+     * FragmentCoalesceSize (64 bytes) are copied into 1 KB buffer on the stack and consecutive short fragments are
+     * calculated as one block. Longer fragments are calculated in place, starting from remainder of preceding data.
+     * Only remainder is passed between fragments, no kernel state (ie. partially filled words or folding registers) is
+     * carried across fragment boundaries, so every long fragment pays head and tail processing of the implementation.
+     */
+    static constexpr ChecksumType calculate(std::span<const std::span<const uint8_t>> fragments) {
+        return finalize(CRC::calculatePartial(initialize(), fragments));
+    }
+
+    static constexpr ChecksumType calculatePartial(ChecksumType init,
+                                                   std::span<const std::span<const uint8_t>> fragments) {
+        return calculatePartialFragments(init, fragments, [](std::span<const uint8_t> fragment) { return fragment; });
+    }
+
+#if __has_include(<sys/uio.h>)
+    static ChecksumType calculate(std::span<const iovec> fragments) {
+        return finalize(CRC::calculatePartial(initialize(), fragments));
+    }
+
+    static ChecksumType calculatePartial(ChecksumType init, std::span<const iovec> fragments) {
+        return calculatePartialFragments(init, fragments, [](const iovec &fragment) {
+            return std::span<const uint8_t>(static_cast<const uint8_t *>(fragment.iov_base), fragment.iov_len);
+        });
+    }
+#endif
+
+    static constexpr size_t FragmentCoalesceSize = 64;
+
+    /**
+     * Calculates CRC of every message and stores it in out at the same index, throws std::invalid_argument when out is
+     * shorter than messages. With Table256, SliceN and Braid implementations several messages are processed in
+     * lockstep with 256 element table, it is much faster than calling calculate for every message when messages are
+     * short. Other implementations calculate messages one by one, so hardware implementations keep their speed and
+     * BitShift and Table16 don't add 256 element table to the binary.
+     */
+    static void calculateBatch(std::span<const std::span<const uint8_t>> messages, std::span<ChecksumType> out) {
+        if (out.size() < messages.size()) {
+            throw std::invalid_argument("CRC batch output is shorter than messages.");
+        }
+        out = out.first(messages.size());
+        if constexpr (fixedLengthMaxWidth() > 0) {
+            crcDetail::calculateBatch<ChecksumType, poly.polynomial, poly.length, inputReflected(),
+                                      isMsbImplementation()>(messages, out, initialize());
+            for (auto &crc : out) {
+                crc = finalize(crc);
+            }
+        } else {
+            for (size_t i = 0; i < messages.size(); i++) {
+                out[i] = calculate(messages[i]);
+            }
+        }
+    }
+
+    /**
+     * Copies source to destination and calculates CRC of copied data in one pass over memory, data is processed in
+     * chunks of CopyChunkSize bytes that are copied while they are still in cache. Copies of at least
+     * CopyNonTemporalThreshold bytes use non-temporal stores, so destination doesn't evict other data from cache.
+     * Throws std::invalid_argument when destination is shorter than source.
+     */
+    static constexpr ChecksumType copyAndCalculate(std::span<uint8_t> destination, std::span<const uint8_t> source) {
+        return finalize(copyAndCalculatePartial(initialize(), destination, source));
+    }
+
+    static constexpr ChecksumType copyAndCalculatePartial(ChecksumType init, std::span<uint8_t> destination,
+                                                          std::span<const uint8_t> source) {
+        if (destination.size() < source.size()) {
+            throw std::invalid_argument("CRC copy destination is shorter than source.");
+        }
+        if (std::is_constant_evaluated()) {
+            std::copy(source.begin(), source.end(), destination.begin());
+            return CRC::calculatePartial(init, source);
+        }
+        const bool nonTemporal = source.size() >= CopyNonTemporalThreshold;
+        for (size_t offset = 0; offset < source.size(); offset += CopyChunkSize) {
+            const size_t chunk = std::min(CopyChunkSize, source.size() - offset);
+            init = CRC::calculatePartial(init, source.data() + offset, chunk);
+            if (nonTemporal) {
+                crcDetail::copyNonTemporal(destination.data() + offset, source.data() + offset, chunk);
+            } else {
+                std::memcpy(destination.data() + offset, source.data() + offset, chunk);
+            }
+        }
+        if (nonTemporal) {
+            crcDetail::storeFence();
+        }
+        return init;
+    }
+
+    static constexpr size_t CopyChunkSize = 16 * 1024;
+    static constexpr size_t CopyNonTemporalThreshold = 4 * 1024 * 1024;
+
+#if defined(__STDCPP_THREADS__)
+    /**
+     * Calculates CRC of data using threadCount threads, every thread calculates remainder of one slice of data and
+     * remainders are merged with shift function. Data shorter than ParallelMinimalSliceSize per thread is calculated by
+     * fewer threads, so small buffers are calculated by the calling thread only.
+     */
+    static ChecksumType calculateParallel(std::span<const uint8_t> data,
+                                          size_t threadCount = std::thread::hardware_concurrency()) {
+        threadCount = std::min(threadCount, data.size() / ParallelMinimalSliceSize);
+        if (threadCount <= 1) {
+            return calculate(data);
+        }
+        const size_t sliceSize = data.size() / threadCount;
+        // last slice also contains remaining bytes
+        auto slice = [&](size_t index) {
+            const size_t offset = index * sliceSize;
+            return index + 1 == threadCount ? data.subspan(offset) : data.subspan(offset, sliceSize);
+        };
+        std::vector<ChecksumType> remainders(threadCount);
+        {
+            std::vector<std::jthread> threads;
+            threads.reserve(threadCount - 1);
+            for (size_t index = 1; index < threadCount; index++) {
+                threads.emplace_back(
+                    [&remainders, &slice, index] { remainders[index] = CRC::calculatePartial(0, slice(index)); });
+            }
+            remainders[0] = CRC::calculatePartial(initialize(), slice(0));
+        }
+        ChecksumType remainder = remainders[0];
+        for (size_t index = 1; index < threadCount; index++) {
+            remainder = shift(remainder, slice(index).size()) ^ remainders[index];
+        }
+        return finalize(remainder);
+    }
+
+    static constexpr size_t ParallelMinimalSliceSize = 1024 * 1024;
+#endif
+
+    /**
+     * Returns remainder after appending nBytes zero bytes to the message, equal to calculatePartial called with buffer
+     * of nBytes zeros but takes O(log nBytes) time.
+     */
+    static constexpr ChecksumType shift(ChecksumType remainder, uint64_t nBytes) {
+        const uint64_t factor = crcDetail::gf2XPowMod(8 * nBytes, poly.polynomial, poly.length);
+        return multiplyMod(remainder, factor);
+    }
+
+    /**
+     * Calculates remainder of message with count repetitions of byte, equal to calculatePartial called with buffer
+     * filled with byte but takes O(log count) time.
+     */
+    static constexpr ChecksumType calculatePartialRepeated(ChecksumType init, uint8_t byte, uint64_t count) {
+        // remainder of n bytes is sum of remainders of single byte shifted by 0 to n - 1 bytes
+        const ChecksumType byteRemainder = CRC::calculatePartial(0, &byte, 1);
+        const uint64_t byteShift = crcDetail::gf2XPowMod(8, poly.polynomial, poly.length);
+        const uint64_t sum = crcDetail::gf2GeometricSum(byteShift, count, poly.polynomial, poly.length);
+        return shift(init, count) ^ multiplyMod(byteRemainder, sum);
+    }
+
+    static constexpr ChecksumType calculateRepeated(uint8_t byte, uint64_t count) {
+        return finalize(calculatePartialRepeated(initialize(), byte, count));
+    }
+
+    /**
+     * Calculates CRC of concatenated messages A and B from CRC of message A, CRC of message B and length of message B.
+     */
+    static constexpr ChecksumType combine(ChecksumType crcA, ChecksumType crcB, uint64_t lenB) {
+        const ChecksumType remainder = shift(unfinalize(crcA) ^ initialize(), lenB) ^ unfinalize(crcB);
+        return finalize(remainder);
+    }
+
+    /**
+     * Returns CRC of message of totalLen bytes after bytes at offset were changed from oldBytes to newBytes. CRC is
+     * linear so it changes by CRC of difference of bytes shifted to the end of message, update takes
+     * O(newBytes.size() + log(totalLen)) time instead of calculation of whole message. Throws std::invalid_argument
+     * when oldBytes and newBytes have different length or changed bytes don't fit in the message.
+     */
+    static constexpr ChecksumType update(ChecksumType oldCrc, uint64_t offset, std::span<const uint8_t> oldBytes,
+                                         std::span<const uint8_t> newBytes, uint64_t totalLen) {
+        if (oldBytes.size() != newBytes.size()) {
+            throw std::invalid_argument("CRC update old and new bytes have to have the same length.");
+        }
+        if (offset > totalLen || newBytes.size() > totalLen - offset) {
+            throw std::invalid_argument("CRC update changed bytes exceed message length.");
+        }
+        // remainder calculated from zero is linear in data, so remainder of difference is difference of remainders
+        const ChecksumType difference = CRC::calculatePartial(0, oldBytes) ^ CRC::calculatePartial(0, newBytes);
+        const uint64_t trailingBytes = totalLen - offset - newBytes.size();
+        return finalize(unfinalize(oldCrc) ^ shift(difference, trailingBytes));
+    }
+
+ private:
+    static constexpr size_t FragmentBufferSize = 1024;
+
+    template <typename Fragments, typename ToSpan>
+    static constexpr ChecksumType calculatePartialFragments(ChecksumType init, const Fragments &fragments,
+                                                            ToSpan toSpan) {
+        // buffer isn't initialized, only first buffered bytes are ever read
+        std::array<uint8_t, FragmentBufferSize> buffer;
+        size_t buffered = 0;
+        for (const auto &item : fragments) {
+            const std::span<const uint8_t> fragment = toSpan(item);
+            if (fragment.size() < FragmentCoalesceSize) {
+                if (buffered + fragment.size() > buffer.size()) {
+                    init = CRC::calculatePartial(init, buffer.data(), buffered);
+                    buffered = 0;
+                }
+                std::copy(fragment.begin(), fragment.end(), buffer.begin() + buffered);
+                buffered += fragment.size();
+            } else {
+                init = CRC::calculatePartial(init, buffer.data(), buffered);
+                buffered = 0;
+                init = CRC::calculatePartial(init, fragment.data(), fragment.size());
+            }
+        }
+        return CRC::calculatePartial(init, buffer.data(), buffered);
+    }
+
+    // Inverse of finalize function, returns remainder that gives crc after finalization.
+    static constexpr ChecksumType unfinalize(ChecksumType crc) {
+        ChecksumType remainder = crc ^ xorOut;
+        if constexpr (outputReflected() == isMsbImplementation()) {
+            remainder = crcDetail::reflect(remainder, poly.length);
+        }
+        return remainder;
+    }
+
+    // Multiplies remainder by MSB first polynomial factor modulo CRC polynomial.
+    static constexpr ChecksumType multiplyMod(ChecksumType remainder, uint64_t factor) {
+        if constexpr (isMsbImplementation()) {
+            return ChecksumType(crcDetail::gf2MultiplyMod(remainder, factor, poly.polynomial, poly.length));
+        } else {
+            const ChecksumType msbRemainder = crcDetail::reflect(remainder, poly.length);
+            return crcDetail::reflect(
+                ChecksumType(crcDetail::gf2MultiplyMod(msbRemainder, factor, poly.polynomial, poly.length)),
+                poly.length);
+        }
+    }
+};
+
+/**
+ * Calculates CRC of window of windowSize bytes that slides over data one byte at a time, every step takes O(1) time.
+ * Byte entering the window is calculated with crc_table of Table256 or Table256Lsb implementation, contribution of byte
+ * leaving the window is removed with out_table that contains crc_table entries shifted by windowSize bytes.
+ */
+template <typename CRCType, size_t windowSize>
+class RollingCRC {
+    using ChecksumType = decltype(CRCType::initialValue());
+    static constexpr size_t len = CRCType::polynomialLength();
+    // input reflection decides register form, so bytes don't need bit reversal
+    static constexpr bool msb = !CRCType::inputReflected();
+    using Engine = crcDetail::CRCImpl<msb ? Implementation::Table256 : Implementation::Table256Lsb, ChecksumType,
+                                      CRCType::polynomial(), len, CRCType::inputReflected()>;
+
+    // Multiplies remainder by x^(8 * windowSize) modulo CRC polynomial.
+    static constexpr ChecksumType shiftByWindow(ChecksumType value) {
+        const uint64_t factor = crcDetail::gf2XPowMod(8 * windowSize, CRCType::polynomial(), len);
+        if constexpr (msb) {
+            return ChecksumType(crcDetail::gf2MultiplyMod(value, factor, CRCType::polynomial(), len));
+        } else {
+            const ChecksumType msbValue = crcDetail::reflect(value, len);
+            return crcDetail::reflect(
+                ChecksumType(crcDetail::gf2MultiplyMod(msbValue, factor, CRCType::polynomial(), len)), len);
+        }
+    }
+
+    static constexpr std::array<ChecksumType, 256> outTableGenerator() {
+        std::array<ChecksumType, 256> table{};
+        for (size_t byte = 0; byte < 256; byte++) {
+            const uint8_t data = uint8_t(byte);
+            table[byte] = shiftByWindow(Engine::calculatePartial(0, &data, 1));
+        }
+        return table;
+    }
+
+    static constexpr ChecksumType initialValue() {
+        return msb ? CRCType::initialValue() : crcDetail::reflect(CRCType::initialValue(), len);
+    }
+
+ public:
+    static constexpr std::array<ChecksumType, 256> out_table = outTableGenerator();
+
+    /**
+     * Creates rolling CRC of the first window, window of other size than windowSize doesn't compile.
+     */
+    constexpr explicit RollingCRC(std::span<const uint8_t, windowSize> window)
+        : remainder(Engine::calculatePartial(0, window.data(), windowSize)) {}
+
+    /**
+     * Moves window by one byte, outgoing is the first byte of current window and incoming is the byte after window.
+     */
+    constexpr void roll(uint8_t outgoing, uint8_t incoming) {
+        remainder = Engine::calculatePartial(remainder, &incoming, 1) ^ out_table[outgoing];
+    }
+
+    constexpr ChecksumType crc() const {
+        ChecksumType result = remainder ^ initialContribution;
+        if constexpr (CRCType::outputReflected() == msb) {
+            result = crcDetail::reflect(result, len);
+        }
+        return result ^ CRCType::xorOutValue();
+    }
+
+ private:
+    // remainder is calculated from zero, initial value shifted through the whole window is added in crc function
+    static constexpr ChecksumType initialContribution = shiftByWindow(initialValue());
+    ChecksumType remainder;
+};
+
+/**
+ * Calculates several CRCs of the same data in one pass. Data is processed in chunks of ChunkSize bytes. CRCs with
+ * Table256, SliceN and Braid implementations calculate the part of chunk covered by all of them in lockstep: every
+ * LockstepBlockSize bytes block is calculated by unrolled kernels of all these CRCs in one loop iteration, so data is
+ * loaded once and dependency chains of different CRCs overlap. CRCs with other implementations and bytes that are
+ * covered only by some CRCs are calculated by implementation of the CRC while chunk is still in L1 cache.
+ */
+template <typename... CRCTypes>
+class MultiCRC {
+ public:
+    using Checksums = std::tuple<decltype(CRCTypes::initialValue())...>;
+
+    // Part of data calculated by one CRC.
+    struct Range {
+        size_t offset;
+        size_t size;
+    };
+    using Ranges = std::array<Range, sizeof...(CRCTypes)>;
+
+    static constexpr Checksums initialize() { return {CRCTypes::initialize()...}; }
+
+    static constexpr Checksums finalize(Checksums remainders) {
+        return std::apply([](auto... remainder) { return Checksums{CRCTypes::finalize(remainder)...}; }, remainders);
+    }
+
+    static constexpr Checksums calculatePartial(Checksums remainders, std::span<const uint8_t> data) {
+        Ranges ranges;
+        ranges.fill({0, data.size()});
+        return calculatePartial(remainders, data, ranges);
+    }
+
+    /**
+     * Every CRC calculates its own range of data, ie. CRC16 of header and CRC32 of header and payload. Throws
+     * std::invalid_argument when range exceeds data.
+     */
+    static constexpr Checksums calculatePartial(Checksums remainders, std::span<const uint8_t> data,
+                                                const Ranges &ranges) {
+        for (const auto &range : ranges) {
+            if (range.offset > data.size() || range.size > data.size() - range.offset) {
+                throw std::invalid_argument("MultiCRC range exceeds data.");
+            }
+        }
+        for (size_t offset = 0; offset < data.size(); offset += ChunkSize) {
+            const size_t chunkEnd = offset + std::min(ChunkSize, data.size() - offset);
+            remainders = calculateChunk(remainders, data.data(), ranges, offset, chunkEnd,
+                                        std::index_sequence_for<CRCTypes...>{});
+        }
+        return remainders;
+    }
+
+    static constexpr Checksums calculate(std::span<const uint8_t> data) {
+        return finalize(calculatePartial(initialize(), data));
+    }
+
+    static constexpr Checksums calculate(std::span<const uint8_t> data, const Ranges &ranges) {
+        return finalize(calculatePartial(initialize(), data, ranges));
+    }
+
+    static constexpr size_t ChunkSize = 4 * 1024;
+    static constexpr size_t LockstepBlockSize = 16;
+
+ private:
+    template <size_t index>
+    using CRCType = std::tuple_element_t<index, std::tuple<CRCTypes...>>;
+
+    template <typename Crc>
+    static constexpr bool lockstep = Crc::fixedLengthMaxWidth() > 0;
+
+    // lockstep of single CRC would only replace its own loop
+    static constexpr bool lockstepUsed = (size_t{lockstep<CRCTypes>} + ...) >= 2;
+
+    template <size_t... index>
+    static constexpr Checksums calculateChunk(Checksums remainders, const uint8_t *data, const Ranges &ranges,
+                                              size_t chunkBegin, size_t chunkEnd, std::index_sequence<index...>) {
+        // part of chunk covered by every CRC
+        const std::array<size_t, sizeof...(CRCTypes)> begin = {
+            std::clamp(ranges[index].offset, chunkBegin, chunkEnd)...};
+        const std::array<size_t, sizeof...(CRCTypes)> end = {
+            std::clamp(ranges[index].offset + ranges[index].size, chunkBegin, chunkEnd)...};
+
+        // part of chunk covered by all lockstep CRCs, rounded down to whole blocks
+        size_t lockstepBegin = chunkBegin;
+        size_t lockstepEnd = chunkBegin;
+        if constexpr (lockstepUsed) {
+            size_t commonEnd = chunkEnd;
+            (
+                [&] {
+                    if constexpr (lockstep<CRCType<index>>) {
+                        lockstepBegin = std::max(lockstepBegin, begin[index]);
+                        commonEnd = std::min(commonEnd, end[index]);
+                    }
+                }(),
+                ...);
+            if (commonEnd > lockstepBegin) {
+                lockstepEnd = lockstepBegin + (commonEnd - lockstepBegin) / LockstepBlockSize * LockstepBlockSize;
+            } else {
+                lockstepBegin = chunkBegin;
+            }
+        }
+        auto inLockstep = [&]<size_t crc>() { return lockstep<CRCType<crc>> && lockstepEnd > lockstepBegin; };
+
+        // bytes before lockstep part, or the whole part of CRCs that don't take part in lockstep
+        (
+            [&] {
+                auto &remainder = std::get<index>(remainders);
+                const size_t stop = inLockstep.template operator()<index>() ? lockstepBegin : end[index];
+                remainder = CRCType<index>::calculatePartial(remainder, data + begin[index], stop - begin[index]);
+            }(),
+            ...);
+
+        if (lockstepEnd > lockstepBegin) {
+            ((std::get<index>(remainders) = toLockstepForm<index>(std::get<index>(remainders))), ...);
+            for (size_t offset = lockstepBegin; offset < lockstepEnd; offset += LockstepBlockSize) {
+                ((std::get<index>(remainders) = calculateBlock<index>(std::get<index>(remainders), data + offset)),
+                 ...);
+            }
+            ((std::get<index>(remainders) = toLockstepForm<index>(std::get<index>(remainders))), ...);
+
+            // bytes after lockstep part
+            (
+                [&] {
+                    if constexpr (lockstep<CRCType<index>>) {
+                        auto &remainder = std::get<index>(remainders);
+                        remainder = CRCType<index>::calculatePartial(remainder, data + lockstepEnd,
+                                                                     end[index] - lockstepEnd);
+                    }
+                }(),
+                ...);
+        }
+        return remainders;
+    }
+
+    template <size_t index, typename ChecksumType>
+    static constexpr ChecksumType toLockstepForm(ChecksumType remainder) {
+        if constexpr (lockstep<CRCType<index>>) {
+            return CRCType<index>::fixedLengthForm(remainder);
+        } else {
+            return remainder;
+        }
+    }
+
+    template <size_t index, typename ChecksumType>
+    static constexpr ChecksumType calculateBlock(ChecksumType remainder, const uint8_t *data) {
+        if constexpr (lockstep<CRCType<index>>) {
+            return CRCType<index>::template calculateFixedLength<LockstepBlockSize>(remainder, data);
+        } else {
+            return remainder;
+        }
+    }
 };
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -26,26 +26,7 @@
  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
-#include <chrono>
-#include <iostream>
 
-#include "microhal-crc.hpp"
+#include "sweep.h"
 
-using namespace microhal;
-
-#ifndef CRC_TYPE
-#error CRC_TYPE have to be defined, ie.: CRC7 or CRC16_CCITT
-#endif
-
-int main(void) {
-    std::array<uint8_t, 1'000'000> data;
-    data.fill(0xAA);
-
-    auto start = std::chrono::steady_clock::now();
-    for (size_t i = 100; i > 0; --i) {
-        [[maybe_unused]] volatile auto result = CRC_TYPE<Implementation::Table256Lsb>::calculate(data.data(), data.size());
-    }
-    auto stop = std::chrono::steady_clock::now();
-
-    std::cout << "execution time: " << std::chrono::nanoseconds{stop - start}.count() << "ns";
-}
+template json implementationSweep<microhal::Implementation::CRC_IMPLEMENTATION>(size_t);
@@ -0,0 +1,197 @@
+/**
+ * @license    BSD 3-Clause
+ * @brief      CRC library
+ *
+ * @authors    Pawel Okas
+ *
+ * @copyright Copyright (c) 2021, Pawel Okas
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+ * following conditions are met:
+ *
+ *     1. Redistributions of source code must retain the above copyright notice, this list of conditions and the
+ * following disclaimer.
+ *     2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ * following disclaimer in the documentation and/or other materials provided with the distribution.
+ *     3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote
+ * products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * Measurements shared by multiplatformTest translation units. Sweep of every predefined CRC is instantiated for one
+ * implementation per translation unit (sweep.cpp compiled with different CRC_IMPLEMENTATION), so all CRCs with all
+ * implementations are never compiled in one file.
+ */
+
+#ifndef _MICROHAL_CRC_SWEEP_H_
+#define _MICROHAL_CRC_SWEEP_H_
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <microhal-crc.hpp>
+#include <nlohmann/json.hpp>
+
+#if defined(__x86_64__) && !defined(EMBEDDED_TARGET)
+#include <x86intrin.h>
+#endif
+
+using json = nlohmann::json;
+
+extern std::array<uint8_t, 100'000> message;
+extern size_t bytesPerMeasurement;
+
+constexpr std::array<size_t, 7> messageSizes = {16, 64, 256, 1024, 4096, 16384, 65536};
+// every measurement is repeated and the fastest one is reported, it filters out interrupts and preemption
+constexpr size_t repetitions = 3;
+
+inline bool cyclesAvailable() {
+#if defined(__x86_64__) && !defined(EMBEDDED_TARGET)
+    return true;
+#else
+    return false;
+#endif
+}
+
+inline uint64_t readCycles() {
+#if defined(__x86_64__) && !defined(EMBEDDED_TARGET)
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+template <class CRC>
+json crcRuntimeTest(size_t size) {
+    const size_t iterations = std::max(size_t{1}, bytesPerMeasurement / size);
+    std::chrono::nanoseconds bestTime = std::chrono::nanoseconds::max();
+    uint64_t bestCycles = UINT64_MAX;
+    for (size_t repetition = 0; repetition < repetitions; repetition++) {
+        auto start = std::chrono::steady_clock::now();
+        const uint64_t startCycles = readCycles();
+        for (size_t i = iterations; i > 0; --i) {
+            [[maybe_unused]] volatile auto result = CRC::calculate(message.data(), size);
+        }
+        const uint64_t cycles = readCycles() - startCycles;
+        auto stop = std::chrono::steady_clock::now();
+        bestTime = std::min<std::chrono::nanoseconds>(bestTime, stop - start);
+        bestCycles = std::min(bestCycles, cycles);
+    }
+
+    json measurement;
+    measurement["size"] = size;
+    measurement["ns"] = double(bestTime.count()) / double(iterations);
+    if (cyclesAvailable()) measurement["cycles"] = double(bestCycles) / double(iterations);
+    return measurement;
+}
+
+template <class CRC>
+json sizeSweep() {
+    json sweep = json::array();
+    for (auto size : messageSizes) {
+        sweep.push_back(crcRuntimeTest<CRC>(size));
+    }
+    return sweep;
+}
+
+// predefined CRCs in order of the report
+#define CRC_SWEEP_LIST(entry) \
+    entry(CRC3_GSM)           \
+    entry(CRC4_ITU)           \
+    entry(CRC5_EPC)           \
+    entry(CRC5_ITU)           \
+    entry(CRC5_USB)           \
+    entry(CRC7)               \
+    entry(CRC7_MVB)           \
+    entry(CRC8_CCITT)         \
+    entry(CRC8_CDMA2000)      \
+    entry(CRC8_DARC)          \
+    entry(CRC8_DVB_S2)        \
+    entry(CRC8_EBU)           \
+    entry(CRC8_I_CODE)        \
+    entry(CRC8_ITU)           \
+    entry(CRC8_MAXIM)         \
+    entry(CRC8_ROHC)          \
+    entry(CRC8_WCDMA)         \
+    entry(CRC16_CCITT)        \
+    entry(CRC16_ARC)          \
+    entry(CRC16_AUG_CCITT)    \
+    entry(CRC16_BUYPASS)      \
+    entry(CRC16_DECT)         \
+    entry(CRC16_CDMA2000)     \
+    entry(CRC16_DDS_110)      \
+    entry(CRC16_DECT_R)       \
+    entry(CRC16_DECT_X)       \
+    entry(CRC16_DNP)          \
+    entry(CRC16_EN_13757)     \
+    entry(CRC16_GENIBUS)      \
+    entry(CRC16_MAXIM)        \
+    entry(CRC16_MCRF4XX)      \
+    entry(CRC16_RIELLO)       \
+    entry(CRC16_T10_DIF)      \
+    entry(CRC16_TELEDISK)     \
+    entry(CRC16_TMS37157)     \
+    entry(CRC16_USB)          \
+    entry(CRC16_A)            \
+    entry(CRC16_KERMIT)       \
+    entry(CRC16_MODBUS)       \
+    entry(CRC16_X_25)         \
+    entry(CRC16_XMODEM)       \
+    entry(CRC17_CAN)          \
+    entry(CRC21_CAN)          \
+    entry(CRC32)              \
+    entry(CRC32_BZIP2)        \
+    entry(CRC32C)             \
+    entry(CRC32D)             \
+    entry(CRC32_MPEG_2)       \
+    entry(CRC32_POSIX)        \
+    entry(CRC32Q)             \
+    entry(CRC32_JAMCRC)       \
+    entry(CRC32_XFER)
+
+/**
+ * Measures CRC with given index in CRC_SWEEP_LIST calculated with given implementation for all message sizes.
+ */
+template <microhal::Implementation implementation>
+json implementationSweep(size_t crc) {
+#define CRC_SWEEP_ENTRY(name) &sizeSweep<microhal::name<implementation>>,
+    static constexpr std::array sweeps = {CRC_SWEEP_LIST(CRC_SWEEP_ENTRY)};
+#undef CRC_SWEEP_ENTRY
+    return sweeps[crc]();
+}
+
+// every implementation is instantiated only in its own sweep.cpp object
+extern template json implementationSweep<microhal::Implementation::BitShift>(size_t);
+extern template json implementationSweep<microhal::Implementation::BitShiftLsb>(size_t);
+extern template json implementationSweep<microhal::Implementation::Table16>(size_t);
+extern template json implementationSweep<microhal::Implementation::Table16Lsb>(size_t);
+extern template json implementationSweep<microhal::Implementation::Table256>(size_t);
+extern template json implementationSweep<microhal::Implementation::Table256Lsb>(size_t);
+#ifndef EMBEDDED_TARGET
+extern template json implementationSweep<microhal::Implementation::Slice4>(size_t);
+extern template json implementationSweep<microhal::Implementation::Slice4Lsb>(size_t);
+extern template json implementationSweep<microhal::Implementation::Slice8>(size_t);
+extern template json implementationSweep<microhal::Implementation::Slice8Lsb>(size_t);
+extern template json implementationSweep<microhal::Implementation::Slice16>(size_t);
+extern template json implementationSweep<microhal::Implementation::Slice16Lsb>(size_t);
+extern template json implementationSweep<microhal::Implementation::Braid>(size_t);
+extern template json implementationSweep<microhal::Implementation::BraidLsb>(size_t);
+#if defined(__x86_64__)
+extern template json implementationSweep<microhal::Implementation::Clmul>(size_t);
+extern template json implementationSweep<microhal::Implementation::Vpclmul>(size_t);
+extern template json implementationSweep<microhal::Implementation::Sse42>(size_t);
+#endif
+extern template json implementationSweep<microhal::Implementation::Auto>(size_t);
+#endif
+
+#endif  // _MICROHAL_CRC_SWEEP_H_
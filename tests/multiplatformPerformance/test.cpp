@@ -26,84 +26,149 @@
  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
-#include <array>
-#include <chrono>
+/**
+ * Measures every predefined CRC with every implementation for several message sizes and prints JSON with platform
+ * description and results, it is processed by tools/reportGenerator.py. On hosted platforms number of bytes processed
+ * in every measurement can be changed with --bytes option, default value keeps the run short.
+ */
+
+#include <cstdlib>
 #include <iostream>
-#include <microhal-crc.hpp>
-#include <nlohmann/json.hpp>
+#include <string>
+
+#include "sweep.h"
 
 #ifdef EMBEDDED_TARGET
 #include "bsp/nucleo-f411re/bsp.h"
 #include "microhal.h"
 #undef CRC
+#else
+#include <fstream>
 #endif
 
 using namespace microhal;
 
-using json = nlohmann::json;
+std::array<uint8_t, 100'000> message;
+size_t bytesPerMeasurement = 65536;
 
-static std::array<uint8_t, 100'000> message;
+static void output(const std::string &text) {
+#ifdef EMBEDDED_TARGET
+    bsp::debugSerial.write(text);
+#else
+    std::cout << text;
+#endif
+}
 
-template <class CRC>
-std::chrono::nanoseconds crcRuntimeTest() {
-    auto start = std::chrono::steady_clock::now();
-    for (size_t i = 10; i > 0; --i) {
-        [[maybe_unused]] volatile auto result = CRC::calculate(message.data(), message.size());
+static std::string cpuModel() {
+#ifdef EMBEDDED_TARGET
+    return "STM32F411RE";
+#else
+    std::ifstream cpuinfo("/proc/cpuinfo");
+    std::string line;
+    while (std::getline(cpuinfo, line)) {
+        if (line.starts_with("model name") || line.starts_with("Model")) {
+            const size_t separator = line.find(':');
+            if (separator != std::string::npos && separator + 2 <= line.size()) return line.substr(separator + 2);
+        }
     }
-    auto stop = std::chrono::steady_clock::now();
+    return "unknown";
+#endif
+}
 
-    return stop - start;
+static json platform() {
+    json info;
+    info["cpu"] = cpuModel();
+#if defined(__clang__)
+    info["compiler"] = "Clang " __clang_version__;
+#elif defined(__GNUC__)
+    info["compiler"] = "GCC " __VERSION__;
+#else
+    info["compiler"] = "unknown";
+#endif
+#ifdef CRC_COMPILE_FLAGS
+    info["flags"] = CRC_COMPILE_FLAGS;
+#else
+    info["flags"] = "unknown";
+#endif
+    info["cyclesAvailable"] = cyclesAvailable();
+    return info;
 }
 
 template <template <Implementation> class CRC>
-json crcTest() {
+json crcDescription(const char *name) {
+    json description;
+    description["name"] = name;
+    description["poly"] = CRC<Implementation::BitShift>::polynomial();
+    description["polyLength"] = CRC<Implementation::BitShift>::polynomialLength();
+    description["inputReflected"] = CRC<Implementation::BitShift>::inputReflected();
+    description["outputReflected"] = CRC<Implementation::BitShift>::outputReflected();
+    description["initialValue"] = CRC<Implementation::BitShift>::initialValue();
+    return description;
+}
+
+#define CRC_DESCRIPTION(name) +[] { return crcDescription<name>(#name); },
+static const std::array crcDescriptions = {CRC_SWEEP_LIST(CRC_DESCRIPTION)};
+
+static json crcTest(size_t crc) {
     json test;
-    test["CRC"]["poly"] = CRC<Implementation::BitShift>::polynomial();
-    test["CRC"]["polyLength"] = CRC<Implementation::BitShift>::polynomialLength();
-    test["CRC"]["inputReflected"] = CRC<Implementation::BitShift>::inputReflected();
-    test["CRC"]["outputReflected"] = CRC<Implementation::BitShift>::outputReflected();
-    test["CRC"]["initialValue"] = CRC<Implementation::BitShift>::initialValue();
-
-    test["implementation"]["BitShift"] = crcRuntimeTest<CRC<Implementation::BitShift>>().count();
-    test["implementation"]["BitShiftLsb"] = crcRuntimeTest<CRC<Implementation::BitShiftLsb>>().count();
-    test["implementation"]["Table256"] = crcRuntimeTest<CRC<Implementation::Table256>>().count();
-    test["implementation"]["Table256Lsb"] = crcRuntimeTest<CRC<Implementation::Table256Lsb>>().count();
+    test["CRC"] = crcDescriptions[crc]();
+
+    test["implementation"]["BitShift"] = implementationSweep<Implementation::BitShift>(crc);
+    test["implementation"]["BitShiftLsb"] = implementationSweep<Implementation::BitShiftLsb>(crc);
+    test["implementation"]["Table16"] = implementationSweep<Implementation::Table16>(crc);
+    test["implementation"]["Table16Lsb"] = implementationSweep<Implementation::Table16Lsb>(crc);
+    test["implementation"]["Table256"] = implementationSweep<Implementation::Table256>(crc);
+    test["implementation"]["Table256Lsb"] = implementationSweep<Implementation::Table256Lsb>(crc);
+    // tables of slicing implementations of all CRCs don't fit into microcontroller flash
+#ifndef EMBEDDED_TARGET
+    test["implementation"]["Slice4"] = implementationSweep<Implementation::Slice4>(crc);
+    test["implementation"]["Slice4Lsb"] = implementationSweep<Implementation::Slice4Lsb>(crc);
+    test["implementation"]["Slice8"] = implementationSweep<Implementation::Slice8>(crc);
+    test["implementation"]["Slice8Lsb"] = implementationSweep<Implementation::Slice8Lsb>(crc);
+    test["implementation"]["Slice16"] = implementationSweep<Implementation::Slice16>(crc);
+    test["implementation"]["Slice16Lsb"] = implementationSweep<Implementation::Slice16Lsb>(crc);
+    test["implementation"]["Braid"] = implementationSweep<Implementation::Braid>(crc);
+    test["implementation"]["BraidLsb"] = implementationSweep<Implementation::BraidLsb>(crc);
+#if defined(__x86_64__)
+    if (__builtin_cpu_supports("pclmul") && __builtin_cpu_supports("ssse3")) {
+        test["implementation"]["Clmul"] = implementationSweep<Implementation::Clmul>(crc);
+    }
+    if (__builtin_cpu_supports("avx512bw") && __builtin_cpu_supports("vpclmulqdq")) {
+        test["implementation"]["Vpclmul"] = implementationSweep<Implementation::Vpclmul>(crc);
+    }
+    if (__builtin_cpu_supports("sse4.2")) {
+        test["implementation"]["Sse42"] = implementationSweep<Implementation::Sse42>(crc);
+    }
+#endif
+    test["implementation"]["Auto"] = implementationSweep<Implementation::Auto>(crc);
+#endif
     return test;
 }
 
-int main() {
+int main([[maybe_unused]] int argc, [[maybe_unused]] char *argv[]) {
+#ifndef EMBEDDED_TARGET
+    if (argc == 3 && std::string(argv[1]) == "--bytes") {
+        bytesPerMeasurement = std::max(size_t{1}, size_t(std::strtoull(argv[2], nullptr, 10)));
+    } else if (argc != 1) {
+        std::cerr << "Usage: multiplatformTest [--bytes N]\n";
+        return 1;
+    }
+#endif
     message.fill(0xAA);
 
+    // results are written CRC by CRC so the whole report never has to be kept in memory
     json testResult;
-    std::array<json, 6> tests;
-
-    testResult["Compiler"] = "GCC";
-
-    tests[0] = crcTest<CRC8_CCITT>();
-    tests[0]["CRC"]["name"] = "CRC8_CCITT";
-
-    tests[1] = crcTest<CRC8_DARC>();
-    tests[1]["CRC"]["name"] = "CRC8_DARC";
-
-    tests[2] = crcTest<CRC16_CCITT>();
-    tests[2]["CRC"]["name"] = "CRC16_CCITT";
-
-    tests[3] = crcTest<CRC16_ARC>();
-    tests[3]["CRC"]["name"] = "CRC16_ARC";
-
-    tests[4] = crcTest<CRC32>();
-    tests[4]["CRC"]["name"] = "CRC32";
-
-    tests[5] = crcTest<CRC32C>();
-    tests[5]["CRC"]["name"] = "CRC32C";
-
-    testResult = tests;
-
-#ifdef EMBEDDED_TARGET
-    bsp::debugSerial.write(testResult.dump());
-#else
-    std::cout << testResult;
-#endif
+    testResult["platform"] = platform();
+    testResult["sizes"] = messageSizes;
+    const std::string header = testResult.dump();
+    output(header.substr(0, header.size() - 1));
+    output(",\"tests\":[");
+
+    for (size_t i = 0; i < crcDescriptions.size(); i++) {
+        if (i) output(",");
+        output(crcTest(i).dump());
+    }
+    output("]}\n");
 
     return 0;
 }
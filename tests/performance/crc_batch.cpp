@@ -0,0 +1,68 @@
+/**
+ * @license    BSD 3-Clause
+ * @brief      CRC library
+ *
+ * @authors    Pawel Okas
+ *
+ * @copyright Copyright (c) 2021, Pawel Okas
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+ * following conditions are met:
+ *
+ *     1. Redistributions of source code must retain the above copyright notice, this list of conditions and the
+ * following disclaimer.
+ *     2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ * following disclaimer in the documentation and/or other materials provided with the distribution.
+ *     3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote
+ * products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+#include "microhal-crc.hpp"
+
+using namespace microhal;
+
+#ifndef CRC_TYPE
+#error CRC_TYPE have to be defined, ie.: CRC7 or CRC16_CCITT
+#endif
+
+int main(void) {
+    // 10000 packets with length from 64 to 1500 bytes
+    std::vector<uint8_t> data(1'000'000, 0xAA);
+    std::vector<std::span<const uint8_t>> messages;
+    uint32_t seed = 1;
+    for (size_t i = 0, offset = 0; i < 10'000; i++) {
+        seed = seed * 1664525 + 1013904223;
+        const size_t length = 64 + (seed >> 8) % 1437;
+        if (offset + length > data.size()) offset = 0;
+        messages.emplace_back(data.data() + offset, length);
+        offset += length;
+    }
+    std::vector<decltype(CRC_TYPE<>::initialValue())> out(messages.size());
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 10; i > 0; --i) {
+        CRC_TYPE<>::calculateBatch(messages, out);
+    }
+    auto stop = std::chrono::steady_clock::now();
+    for (size_t i = 10; i > 0; --i) {
+        for (size_t message = 0; message < messages.size(); message++) {
+            out[message] = CRC_TYPE<>::calculate(messages[message]);
+        }
+    }
+    auto stopLoop = std::chrono::steady_clock::now();
+
+    std::cout << "execution time: " << std::chrono::nanoseconds{stop - start}.count()
+              << "ns, calculate loop execution time: " << std::chrono::nanoseconds{stopLoop - stop}.count() << "ns";
+}
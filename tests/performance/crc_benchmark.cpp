@@ -0,0 +1,458 @@
+/**
+ * @license    BSD 3-Clause
+ * @brief      CRC library
+ *
+ * @authors    Pawel Okas
+ *
+ * @copyright Copyright (c) 2021, Pawel Okas
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+ * following conditions are met:
+ *
+ *     1. Redistributions of source code must retain the above copyright notice, this list of conditions and the
+ * following disclaimer.
+ *     2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ * following disclaimer in the documentation and/or other materials provided with the distribution.
+ *     3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote
+ * products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * Benchmark of every implementation of key CRCs. Message size, buffer offset and implementation are swept and every
+ * measurement is repeated, result is median time of one calculate call, throughput and bytes per TSC cycle.
+ * Run with --help to see options, ie. --filter CRC32C/Slice --sizes 1K-1M --offsets 0-63. On Linux --counters adds
+ * hardware performance counters per byte, they show whether implementation is latency, port or memory bound.
+ */
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(__x86_64__)
+#include <x86intrin.h>
+#endif
+
+#if __has_include(<linux/perf_event.h>)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "microhal-crc.hpp"
+
+using namespace microhal;
+
+namespace {
+
+struct ImplementationInfo {
+    Implementation implementation;
+    const char *name;
+};
+
+constexpr std::array implementations = {ImplementationInfo{Implementation::BitShift, "BitShift"},
+                                        ImplementationInfo{Implementation::BitShiftLsb, "BitShiftLsb"},
+                                        ImplementationInfo{Implementation::Table16, "Table16"},
+                                        ImplementationInfo{Implementation::Table16Lsb, "Table16Lsb"},
+                                        ImplementationInfo{Implementation::Table256, "Table256"},
+                                        ImplementationInfo{Implementation::Table256Lsb, "Table256Lsb"},
+                                        ImplementationInfo{Implementation::Slice4, "Slice4"},
+                                        ImplementationInfo{Implementation::Slice4Lsb, "Slice4Lsb"},
+                                        ImplementationInfo{Implementation::Slice8, "Slice8"},
+                                        ImplementationInfo{Implementation::Slice8Lsb, "Slice8Lsb"},
+                                        ImplementationInfo{Implementation::Slice16, "Slice16"},
+                                        ImplementationInfo{Implementation::Slice16Lsb, "Slice16Lsb"},
+                                        ImplementationInfo{Implementation::Braid, "Braid"},
+                                        ImplementationInfo{Implementation::BraidLsb, "BraidLsb"},
+#if defined(__x86_64__)
+                                        ImplementationInfo{Implementation::Clmul, "Clmul"},
+                                        ImplementationInfo{Implementation::Vpclmul, "Vpclmul"},
+                                        ImplementationInfo{Implementation::Sse42, "Sse42"},
+#endif
+                                        ImplementationInfo{Implementation::Auto, "Auto"}};
+
+bool isSupported([[maybe_unused]] Implementation implementation) {
+#if defined(__x86_64__)
+    switch (implementation) {
+        case Implementation::Clmul:
+            return __builtin_cpu_supports("pclmul") && __builtin_cpu_supports("ssse3");
+        case Implementation::Vpclmul:
+            return __builtin_cpu_supports("avx512bw") && __builtin_cpu_supports("vpclmulqdq");
+        case Implementation::Sse42:
+            return __builtin_cpu_supports("sse4.2");
+        default:
+            break;
+    }
+#endif
+    return true;
+}
+
+struct Kernel {
+    std::string name;
+    bool supported;
+    uint64_t (*calculate)(const uint8_t *data, size_t lne);
+};
+
+template <template <Implementation> class CRCType>
+void addKernels(std::vector<Kernel> &kernels, const std::string &crc) {
+    [&]<size_t... i>(std::index_sequence<i...>) {
+        (kernels.push_back({crc + "/" + implementations[i].name, isSupported(implementations[i].implementation),
+                            [](const uint8_t *data, size_t lne) -> uint64_t {
+                                return CRCType<implementations[i].implementation>::calculate(data, lne);
+                            }}),
+         ...);
+    }(std::make_index_sequence<implementations.size()>{});
+}
+
+std::vector<Kernel> kernels() {
+    std::vector<Kernel> result;
+    addKernels<CRC7>(result, "CRC7");
+    addKernels<CRC8_MAXIM>(result, "CRC8_MAXIM");
+    addKernels<CRC16_CCITT>(result, "CRC16_CCITT");
+    addKernels<CRC16_MODBUS>(result, "CRC16_MODBUS");
+    addKernels<CRC32>(result, "CRC32");
+    addKernels<CRC32_MPEG_2>(result, "CRC32_MPEG_2");
+    addKernels<CRC32C>(result, "CRC32C");
+    return result;
+}
+
+uint64_t readCycles() {
+#if defined(__x86_64__)
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+// Group of hardware counters read with perf_event_open, counting only user space code of this thread.
+class PerfCounters {
+ public:
+    static constexpr size_t count = 4;
+    static constexpr std::array<const char *, count> names = {"cycles/B", "instr/B", "L1Dmiss/B", "brmiss/B"};
+    using Values = std::array<uint64_t, count>;
+
+    PerfCounters() = default;
+    PerfCounters(const PerfCounters &) = delete;
+    PerfCounters &operator=(const PerfCounters &) = delete;
+    ~PerfCounters() {
+#if __has_include(<linux/perf_event.h>)
+        for (auto fd : fds) {
+            if (fd >= 0) close(fd);
+        }
+#endif
+    }
+
+    bool open() {
+#if __has_include(<linux/perf_event.h>)
+        constexpr std::array<std::pair<uint32_t, uint64_t>, count> events = {
+            std::pair<uint32_t, uint64_t>{PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+            std::pair<uint32_t, uint64_t>{PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+            std::pair<uint32_t, uint64_t>{PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D |
+                                                                  (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                                                                  (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)},
+            std::pair<uint32_t, uint64_t>{PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES}};
+        for (size_t i = 0; i < count; i++) {
+            perf_event_attr attr = {};
+            attr.size = sizeof(attr);
+            attr.type = events[i].first;
+            attr.config = events[i].second;
+            attr.disabled = i == 0;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            attr.read_format = PERF_FORMAT_GROUP;
+            fds[i] = int(syscall(SYS_perf_event_open, &attr, 0, -1, i == 0 ? -1 : fds[0], 0));
+            if (fds[i] < 0) return false;
+        }
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    void start() {
+#if __has_include(<linux/perf_event.h>)
+        ioctl(fds[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+#endif
+    }
+
+    Values stop() {
+        struct {
+            uint64_t nr;
+            Values values;
+        } group = {};
+#if __has_include(<linux/perf_event.h>)
+        ioctl(fds[0], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+        if (read(fds[0], &group, sizeof(group)) != sizeof(group)) group.values = {};
+#endif
+        return group.values;
+    }
+
+ private:
+    std::array<int, count> fds = {-1, -1, -1, -1};
+};
+
+struct Options {
+    std::vector<size_t> sizes;
+    std::vector<size_t> offsets = {0, 1, 7, 8, 32, 63};
+    size_t repetitions = 5;
+    std::chrono::nanoseconds minTime = std::chrono::milliseconds(10);
+    std::string filter;
+    bool csv = false;
+    bool counters = false;
+};
+
+struct Measurement {
+    double nanoseconds;
+    double cycles;
+    std::array<double, PerfCounters::count> counters;
+};
+
+volatile uint64_t sink;
+
+// Like Google Benchmark increases number of iterations until run takes at least minTime and returns time of one call.
+// When counters are given they are read around the measured loop and returned per call.
+Measurement measure(const Kernel &kernel, const uint8_t *data, size_t size, std::chrono::nanoseconds minTime,
+                    PerfCounters *counters) {
+    size_t iterations = 1;
+    while (true) {
+        if (counters) counters->start();
+        const auto start = std::chrono::steady_clock::now();
+        const uint64_t startCycles = readCycles();
+        for (size_t i = 0; i < iterations; i++) {
+            sink = kernel.calculate(data, size);
+        }
+        const uint64_t cycles = readCycles() - startCycles;
+        const std::chrono::nanoseconds elapsed = std::chrono::steady_clock::now() - start;
+        const PerfCounters::Values values = counters ? counters->stop() : PerfCounters::Values{};
+        if (elapsed >= minTime) {
+            Measurement measurement = {double(elapsed.count()) / double(iterations),
+                                       double(cycles) / double(iterations), {}};
+            for (size_t i = 0; i < values.size(); i++) {
+                measurement.counters[i] = double(values[i]) / double(iterations);
+            }
+            return measurement;
+        }
+        iterations *= elapsed * 10 < minTime ? size_t{10} : size_t{2};
+    }
+}
+
+size_t parseSize(const std::string &text) {
+    size_t suffix = 0;
+    const size_t value = std::stoull(text, &suffix);
+    if (suffix == text.size()) return value;
+    switch (text[suffix]) {
+        case 'K':
+            return value << 10;
+        case 'M':
+            return value << 20;
+        case 'G':
+            return value << 30;
+    }
+    throw std::invalid_argument("incorrect size " + text);
+}
+
+// Parses range like 1-64K, sizes grow four times in every step.
+std::vector<size_t> parseSizes(const std::string &text) {
+    const size_t separator = text.find('-');
+    const size_t first = parseSize(text.substr(0, separator));
+    const size_t last = separator == std::string::npos ? first : parseSize(text.substr(separator + 1));
+    std::vector<size_t> sizes;
+    for (size_t size = std::max(first, size_t{1}); size <= last; size *= 4) {
+        sizes.push_back(size);
+    }
+    return sizes;
+}
+
+// Parses list of offsets and ranges like 0,1,8-15.
+std::vector<size_t> parseOffsets(const std::string &text) {
+    std::vector<size_t> offsets;
+    size_t begin = 0;
+    while (begin < text.size()) {
+        const size_t end = std::min(text.find(',', begin), text.size());
+        const std::string item = text.substr(begin, end - begin);
+        const size_t separator = item.find('-');
+        const size_t first = std::stoull(item.substr(0, separator));
+        const size_t last = separator == std::string::npos ? first : std::stoull(item.substr(separator + 1));
+        for (size_t offset = first; offset <= last; offset++) {
+            if (offset >= 64) throw std::invalid_argument("offset have to be lower than 64");
+            offsets.push_back(offset);
+        }
+        begin = end + 1;
+    }
+    return offsets;
+}
+
+void printUsage() {
+    std::cout << "Usage: perfBenchmark [OPTION]...\n"
+                 "  --sizes MIN-MAX     message sizes, every step is four times bigger, default 1-1G\n"
+                 "  --offsets LIST      buffer offsets from 64 byte aligned address, ie. 0-63 or 0,1,8, default "
+                 "0,1,7,8,32,63\n"
+                 "  --repetitions N     number of measurements of every case, default 5\n"
+                 "  --min-time MS       minimal time of one measurement in milliseconds, default 10\n"
+                 "  --filter TEXT       run only CRC/implementation names containing TEXT, ie. CRC32C/Slice\n"
+                 "  --csv               print results in CSV format\n"
+                 "  --counters          print hardware performance counters per byte, Linux only\n"
+                 "  --quick             short run used by tests: sizes 1-64K, offsets 0,1, one repetition\n";
+}
+
+Options parseOptions(int argc, char *argv[]) {
+    Options options;
+    options.sizes = parseSizes("1-1G");
+    for (int i = 1; i < argc; i++) {
+        const std::string argument = argv[i];
+        auto value = [&]() -> std::string {
+            if (i + 1 == argc) throw std::invalid_argument("option " + argument + " requires an argument");
+            return argv[++i];
+        };
+        if (argument == "--sizes") {
+            options.sizes = parseSizes(value());
+        } else if (argument == "--offsets") {
+            options.offsets = parseOffsets(value());
+        } else if (argument == "--repetitions") {
+            options.repetitions = std::max(size_t{1}, size_t(std::stoull(value())));
+        } else if (argument == "--min-time") {
+            options.minTime = std::chrono::nanoseconds(int64_t(std::stod(value()) * 1e6));
+        } else if (argument == "--filter") {
+            options.filter = value();
+        } else if (argument == "--csv") {
+            options.csv = true;
+        } else if (argument == "--counters") {
+            options.counters = true;
+        } else if (argument == "--quick") {
+            options.sizes = parseSizes("1-64K");
+            options.offsets = {0, 1};
+            options.repetitions = 1;
+            options.minTime = std::chrono::microseconds(100);
+        } else if (argument == "--help") {
+            printUsage();
+            std::exit(0);
+        } else {
+            throw std::invalid_argument("unknown option " + argument);
+        }
+    }
+    return options;
+}
+
+double median(std::vector<double> values) {
+    std::sort(values.begin(), values.end());
+    const size_t middle = values.size() / 2;
+    return values.size() % 2 ? values[middle] : (values[middle - 1] + values[middle]) / 2;
+}
+
+// coefficient of variation in percent, shows how stable the measurement was
+double variation(const std::vector<double> &values) {
+    double mean = 0;
+    for (auto value : values) mean += value;
+    mean /= double(values.size());
+    double variance = 0;
+    for (auto value : values) variance += (value - mean) * (value - mean);
+    return 100 * std::sqrt(variance / double(values.size())) / mean;
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+    Options options;
+    try {
+        options = parseOptions(argc, argv);
+    } catch (const std::exception &error) {
+        std::cerr << "perfBenchmark: " << error.what() << '\n';
+        printUsage();
+        return 1;
+    }
+
+    const size_t maxSize = options.sizes.empty() ? 0 : options.sizes.back();
+    const auto buffer = std::make_unique<uint8_t[]>(maxSize + 128);
+    uint8_t *const aligned = buffer.get() + (64 - reinterpret_cast<uintptr_t>(buffer.get()) % 64);
+    uint32_t seed = 1;
+    for (size_t i = 0; i < maxSize + 64; i++) {
+        seed = seed * 1664525 + 1013904223;
+        aligned[i] = uint8_t(seed >> 24);
+    }
+
+    PerfCounters perfCounters;
+    if (options.counters && !perfCounters.open()) {
+        std::cerr << "perfBenchmark: hardware performance counters are not available, running without them\n";
+        options.counters = false;
+    }
+
+    if (options.csv) {
+        std::cout << "crc,implementation,size,offset,ns,GB/s,bytes/cycle,cv%";
+        if (options.counters) {
+            for (auto name : PerfCounters::names) std::cout << ',' << name;
+        }
+        std::cout << '\n';
+    } else {
+        std::cout << std::left << std::setw(28) << "CRC/implementation" << std::right << std::setw(12) << "size"
+                  << std::setw(8) << "offset" << std::setw(16) << "ns/call" << std::setw(10) << "GB/s"
+                  << std::setw(13) << "bytes/cycle" << std::setw(8) << "cv%";
+        if (options.counters) {
+            for (auto name : PerfCounters::names) std::cout << std::setw(11) << name;
+        }
+        std::cout << '\n';
+    }
+    for (const auto &kernel : kernels()) {
+        if (!kernel.supported || kernel.name.find(options.filter) == std::string::npos) continue;
+        for (auto size : options.sizes) {
+            for (auto offset : options.offsets) {
+                std::vector<double> nanoseconds;
+                std::vector<double> cycles;
+                std::array<std::vector<double>, PerfCounters::count> counters;
+                for (size_t repetition = 0; repetition < options.repetitions; repetition++) {
+                    const auto measurement = measure(kernel, aligned + offset, size, options.minTime,
+                                                     options.counters ? &perfCounters : nullptr);
+                    nanoseconds.push_back(measurement.nanoseconds);
+                    cycles.push_back(measurement.cycles);
+                    for (size_t i = 0; i < counters.size(); i++) {
+                        counters[i].push_back(measurement.counters[i]);
+                    }
+                }
+                const double time = median(nanoseconds);
+                const double cyclesPerCall = median(cycles);
+                const double gbPerSecond = double(size) / time;
+                const double bytesPerCycle = cyclesPerCall > 0 ? double(size) / cyclesPerCall : 0;
+                if (options.csv) {
+                    const size_t separator = kernel.name.find('/');
+                    std::cout << kernel.name.substr(0, separator) << ',' << kernel.name.substr(separator + 1) << ','
+                              << size << ',' << offset << ',' << time << ',' << gbPerSecond << ',' << bytesPerCycle
+                              << ',' << variation(nanoseconds);
+                    if (options.counters) {
+                        for (const auto &counter : counters) std::cout << ',' << median(counter) / double(size);
+                    }
+                    std::cout << '\n';
+                } else {
+                    std::cout << std::left << std::setw(28) << kernel.name << std::right << std::setw(12) << size
+                              << std::setw(8) << offset << std::fixed << std::setprecision(2) << std::setw(16) << time
+                              << std::setw(10) << gbPerSecond << std::setprecision(3) << std::setw(13)
+                              << bytesPerCycle << std::setprecision(1) << std::setw(8) << variation(nanoseconds);
+                    if (options.counters) {
+                        std::cout << std::setprecision(4);
+                        for (const auto &counter : counters) {
+                            std::cout << std::setw(11) << median(counter) / double(size);
+                        }
+                    }
+                    std::cout << '\n';
+                }
+            }
+        }
+    }
+}
@@ -25,11 +25,10 @@
  * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
-
 #include <chrono>
 #include <iostream>
 
-#include "microhal-crc.hpp"
+#include "microhal-crc-dynamic.hpp"
 
 using namespace microhal;
 
@@ -41,9 +40,10 @@ int main(void) {
     std::array<uint8_t, 1'000'000> data;
     data.fill(0xAA);
 
+    const auto crc = DynamicCRC::from<CRC_TYPE<>>();
     auto start = std::chrono::steady_clock::now();
     for (size_t i = 100; i > 0; --i) {
-        [[maybe_unused]] volatile auto result = CRC_TYPE<Implementation::BitShift>::calculate(data.data(), data.size());
+        [[maybe_unused]] volatile auto result = crc.calculate(data.data(), data.size());
     }
     auto stop = std::chrono::steady_clock::now();
 
@@ -0,0 +1,223 @@
+/**
+ * @license    BSD 3-Clause
+ * @brief      CRC library
+ *
+ * @authors    Pawel Okas
+ *
+ * @copyright Copyright (c) 2021, Pawel Okas
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+ * following conditions are met:
+ *
+ *     1. Redistributions of source code must retain the above copyright notice, this list of conditions and the
+ * following disclaimer.
+ *     2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ * following disclaimer in the documentation and/or other materials provided with the distribution.
+ *     3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote
+ * products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * Measures latency of single calculate call for tiny messages: 5 byte SD card command with CRC7, 8 byte CAN frame
+ * payload with CRC17_CAN and 16 byte header with CRC32C. Every call is measured separately and p50/p99 are reported,
+ * with warm caches and after lookup tables of implementation were flushed from cache before every call. Hardware
+ * implementations calculate short messages with table fallback, so tables of the fallback are flushed too.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#if defined(__x86_64__)
+#include <x86intrin.h>
+#endif
+
+#include "microhal-crc.hpp"
+
+using namespace microhal;
+
+namespace {
+
+// On x86-64 time is measured in TSC cycles, on other platforms in nanoseconds.
+#if defined(__x86_64__)
+constexpr const char *unit = "cycles";
+
+inline uint64_t timestamp() {
+    _mm_lfence();
+    const uint64_t time = __rdtsc();
+    _mm_lfence();
+    return time;
+}
+
+void flush(const void *address, size_t size) {
+    const auto *bytes = static_cast<const char *>(address);
+    for (size_t offset = 0; offset < size; offset += 64) {
+        _mm_clflush(bytes + offset);
+    }
+    _mm_mfence();
+}
+#else
+constexpr const char *unit = "ns";
+
+inline uint64_t timestamp() {
+    return uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        std::chrono::steady_clock::now().time_since_epoch())
+                        .count());
+}
+
+void flush(const void *, size_t) {}
+#endif
+
+volatile uint64_t sink;
+
+struct Latency {
+    uint64_t p50;
+    uint64_t p99;
+};
+
+Latency percentiles(std::vector<uint64_t> samples, uint64_t overhead) {
+    std::sort(samples.begin(), samples.end());
+    auto percentile = [&](size_t percent) {
+        const uint64_t sample = samples[std::min(samples.size() - 1, samples.size() * percent / 100)];
+        return sample > overhead ? sample - overhead : 0;
+    };
+    return {percentile(50), percentile(99)};
+}
+
+// Time of empty measurement, it is subtracted from every result.
+uint64_t timerOverhead(size_t samples) {
+    std::vector<uint64_t> times(samples);
+    for (auto &time : times) {
+        const uint64_t start = timestamp();
+        time = timestamp() - start;
+    }
+    return percentiles(times, 0).p50;
+}
+
+template <typename Crc>
+constexpr bool hasTables() {
+    return requires { Crc::table(); } || requires { Crc::tables(); };
+}
+
+// Flushes lookup tables of implementation, hardware implementations expose tables of their table based fallback.
+template <typename Crc>
+void flushTables() {
+    if constexpr (requires { Crc::table(); }) {
+        flush(Crc::table().data(), sizeof(Crc::table()));
+    }
+    if constexpr (requires { Crc::tables(); }) {
+        flush(Crc::tables().data(), sizeof(Crc::tables()));
+    }
+}
+
+// Auto implementation selects kernel at run time, so tables of every implementation it can select are flushed.
+template <template <Implementation> class CRCType, Implementation implementation>
+void flushTables() {
+    if constexpr (implementation == Implementation::Auto) {
+        flushTables<CRCType<Implementation::Slice8>>();
+#if defined(__x86_64__)
+        if constexpr (CRCType<Implementation::BitShift>::polynomialLength() <= 32) {
+            flushTables<CRCType<Implementation::Clmul>>();
+            flushTables<CRCType<Implementation::Vpclmul>>();
+            flushTables<CRCType<Implementation::Sse42>>();
+        }
+#endif
+    } else {
+        flushTables<CRCType<implementation>>();
+    }
+}
+
+template <template <Implementation> class CRCType, Implementation implementation>
+constexpr bool hasTables() {
+    if constexpr (implementation == Implementation::Auto) {
+        return true;
+    } else {
+        return hasTables<CRCType<implementation>>();
+    }
+}
+
+template <template <Implementation> class CRCType, Implementation implementation>
+std::vector<uint64_t> measure(const std::vector<uint8_t> &message, size_t samples, bool cold) {
+    using Crc = CRCType<implementation>;
+    std::vector<uint64_t> times(samples);
+    for (auto &time : times) {
+        if (cold) flushTables<CRCType, implementation>();
+        const uint64_t start = timestamp();
+        sink = Crc::calculate(message.data(), message.size());
+        time = timestamp() - start;
+    }
+    return times;
+}
+
+template <template <Implementation> class CRCType, Implementation implementation>
+void run(const char *name, const char *implementationName, size_t messageSize, size_t samples, uint64_t overhead) {
+    std::vector<uint8_t> message(messageSize);
+    for (size_t i = 0; i < message.size(); i++) {
+        message[i] = uint8_t(i * 29 + 3);
+    }
+    const auto warm = percentiles(measure<CRCType, implementation>(message, samples, false), overhead);
+    const auto cold = percentiles(measure<CRCType, implementation>(message, samples, true), overhead);
+    std::cout << std::left << std::setw(28) << (std::string(name) + "/" + implementationName) << std::right
+              << std::setw(6) << messageSize << std::setw(10) << warm.p50 << std::setw(10) << warm.p99
+              << std::setw(10) << cold.p50 << std::setw(10) << cold.p99;
+    if constexpr (!hasTables<CRCType, implementation>()) {
+        std::cout << "  (no table)";
+    }
+    std::cout << '\n';
+}
+
+template <template <Implementation> class CRCType>
+void runImplementations(const char *name, size_t messageSize, size_t samples, uint64_t overhead) {
+    run<CRCType, Implementation::BitShift>(name, "BitShift", messageSize, samples, overhead);
+    run<CRCType, Implementation::BitShiftLsb>(name, "BitShiftLsb", messageSize, samples, overhead);
+    run<CRCType, Implementation::Table16>(name, "Table16", messageSize, samples, overhead);
+    run<CRCType, Implementation::Table16Lsb>(name, "Table16Lsb", messageSize, samples, overhead);
+    run<CRCType, Implementation::Table256>(name, "Table256", messageSize, samples, overhead);
+    run<CRCType, Implementation::Table256Lsb>(name, "Table256Lsb", messageSize, samples, overhead);
+#if defined(__x86_64__)
+    if (__builtin_cpu_supports("pclmul") && __builtin_cpu_supports("ssse3")) {
+        run<CRCType, Implementation::Clmul>(name, "Clmul", messageSize, samples, overhead);
+    }
+    if (__builtin_cpu_supports("avx512bw") && __builtin_cpu_supports("vpclmulqdq")) {
+        run<CRCType, Implementation::Vpclmul>(name, "Vpclmul", messageSize, samples, overhead);
+    }
+    if (__builtin_cpu_supports("sse4.2")) {
+        run<CRCType, Implementation::Sse42>(name, "Sse42", messageSize, samples, overhead);
+    }
+#endif
+    run<CRCType, Implementation::Auto>(name, "Auto", messageSize, samples, overhead);
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+    size_t samples = 10'000;
+    if (argc == 3 && std::string(argv[1]) == "--samples") {
+        samples = std::max(size_t{1}, size_t(std::strtoull(argv[2], nullptr, 10)));
+    } else if (argc != 1) {
+        std::cerr << "Usage: perfLatency [--samples N]\n";
+        return 1;
+    }
+    const uint64_t overhead = timerOverhead(samples);
+    std::cout << "latency of one calculate call in " << unit << ", timer overhead " << overhead
+              << " subtracted, cold: tables of implementation (and of its table fallback) flushed from cache before every call\n";
+    std::cout << std::left << std::setw(28) << "CRC/implementation" << std::right << std::setw(6) << "bytes"
+              << std::setw(10) << "warm p50" << std::setw(10) << "warm p99" << std::setw(10) << "cold p50"
+              << std::setw(10) << "cold p99" << '\n';
+    runImplementations<CRC7>("CRC7", 5, samples, overhead);
+    runImplementations<CRC17_CAN>("CRC17_CAN", 8, samples, overhead);
+    runImplementations<CRC32C>("CRC32C", 16, samples, overhead);
+}
@@ -0,0 +1,61 @@
+/**
+ * @license    BSD 3-Clause
+ * @brief      CRC library
+ *
+ * @authors    Pawel Okas
+ *
+ * @copyright Copyright (c) 2021, Pawel Okas
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+ * following conditions are met:
+ *
+ *     1. Redistributions of source code must retain the above copyright notice, this list of conditions and the
+ * following disclaimer.
+ *     2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ * following disclaimer in the documentation and/or other materials provided with the distribution.
+ *     3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote
+ * products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+#include "microhal-crc.hpp"
+
+using namespace microhal;
+
+#ifndef CRC_IMPLEMENTATION
+#error CRC_IMPLEMENTATION have to be defined, ie.: Slice4 or Slice8Lsb
+#endif
+
+int main(void) {
+    using Crc32 = CRC32<Implementation::CRC_IMPLEMENTATION>;
+    using Crc32C = CRC32C<Implementation::CRC_IMPLEMENTATION>;
+    std::vector<uint8_t> data(64 * 1024 * 1024, 0xAA);
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 10; i > 0; --i) {
+        const auto [crc32, crc32c] = MultiCRC<Crc32, Crc32C>::calculate(data);
+        [[maybe_unused]] volatile auto result32 = crc32;
+        [[maybe_unused]] volatile auto result32c = crc32c;
+    }
+    auto stop = std::chrono::steady_clock::now();
+    for (size_t i = 10; i > 0; --i) {
+        [[maybe_unused]] volatile auto crc32 = Crc32::calculate(data);
+        [[maybe_unused]] volatile auto crc32c = Crc32C::calculate(data);
+    }
+    auto stopTwoPass = std::chrono::steady_clock::now();
+
+    std::cout << "execution time: " << std::chrono::nanoseconds{stop - start}.count()
+              << "ns, two pass execution time: " << std::chrono::nanoseconds{stopTwoPass - stop}.count() << "ns";
+}
@@ -25,7 +25,6 @@
  * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
-
 #include <chrono>
 #include <iostream>
 
@@ -37,15 +36,21 @@ using namespace microhal;
 #error CRC_TYPE have to be defined, ie.: CRC7 or CRC16_CCITT
 #endif
 
+#ifndef CRC_IMPLEMENTATION
+#error CRC_IMPLEMENTATION have to be defined, ie.: Table16 or Table256Lsb
+#endif
+
 int main(void) {
     std::array<uint8_t, 1'000'000> data;
     data.fill(0xAA);
 
+    using Crc = CRC_TYPE<Implementation::CRC_IMPLEMENTATION>;
     auto start = std::chrono::steady_clock::now();
     for (size_t i = 100; i > 0; --i) {
-        [[maybe_unused]] volatile auto result = CRC_TYPE<Implementation::BitShiftLsb>::calculate(data.data(), data.size());
+        [[maybe_unused]] volatile auto result = Crc::calculate(data.data(), data.size());
     }
     auto stop = std::chrono::steady_clock::now();
 
-    std::cout << "execution time: " << std::chrono::nanoseconds{stop - start}.count() << "ns";
+    std::cout << "execution time: " << std::chrono::nanoseconds{stop - start}.count() << "ns, table size: "
+              << sizeof(Crc::table()) << " bytes";
 }
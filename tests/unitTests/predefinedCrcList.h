@@ -0,0 +1,92 @@
+/**
+ * @license    BSD 3-Clause
+ * @brief      CRC library
+ *
+ * @authors    Pawel Okas
+ *
+ * @copyright Copyright (c) 2021, Pawel Okas
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+ * following conditions are met:
+ *
+ *     1. Redistributions of source code must retain the above copyright notice, this list of conditions and the
+ * following disclaimer.
+ *     2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ * following disclaimer in the documentation and/or other materials provided with the distribution.
+ *     3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote
+ * products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _MICROHAL_CRC_PREDEFINED_CRC_LIST_H_
+#define _MICROHAL_CRC_PREDEFINED_CRC_LIST_H_
+
+#include "microhal-crc.hpp"
+
+/**
+ * Calls check<CRC>(name, args...) for every predefined CRC, check is template of function that accepts CRC alias
+ * template, ie.: template <template <Implementation> class CRC> void checkCombine(const char *name);
+ */
+#define FOR_EACH_PREDEFINED_CRC(check, ...)                                         \
+    check<microhal::CRC3_GSM>("CRC3_GSM" __VA_OPT__(, ) __VA_ARGS__);               \
+    check<microhal::CRC4_ITU>("CRC4_ITU" __VA_OPT__(, ) __VA_ARGS__);               \
+    check<microhal::CRC5_EPC>("CRC5_EPC" __VA_OPT__(, ) __VA_ARGS__);               \
+    check<microhal::CRC5_ITU>("CRC5_ITU" __VA_OPT__(, ) __VA_ARGS__);               \
+    check<microhal::CRC5_USB>("CRC5_USB" __VA_OPT__(, ) __VA_ARGS__);               \
+    check<microhal::CRC7>("CRC7" __VA_OPT__(, ) __VA_ARGS__);                       \
+    check<microhal::CRC7_MVB>("CRC7_MVB" __VA_OPT__(, ) __VA_ARGS__);               \
+    check<microhal::CRC8_CCITT>("CRC8_CCITT" __VA_OPT__(, ) __VA_ARGS__);           \
+    check<microhal::CRC8_CDMA2000>("CRC8_CDMA2000" __VA_OPT__(, ) __VA_ARGS__);     \
+    check<microhal::CRC8_DARC>("CRC8_DARC" __VA_OPT__(, ) __VA_ARGS__);             \
+    check<microhal::CRC8_DVB_S2>("CRC8_DVB_S2" __VA_OPT__(, ) __VA_ARGS__);         \
+    check<microhal::CRC8_EBU>("CRC8_EBU" __VA_OPT__(, ) __VA_ARGS__);               \
+    check<microhal::CRC8_I_CODE>("CRC8_I_CODE" __VA_OPT__(, ) __VA_ARGS__);         \
+    check<microhal::CRC8_ITU>("CRC8_ITU" __VA_OPT__(, ) __VA_ARGS__);               \
+    check<microhal::CRC8_MAXIM>("CRC8_MAXIM" __VA_OPT__(, ) __VA_ARGS__);           \
+    check<microhal::CRC8_ROHC>("CRC8_ROHC" __VA_OPT__(, ) __VA_ARGS__);             \
+    check<microhal::CRC8_WCDMA>("CRC8_WCDMA" __VA_OPT__(, ) __VA_ARGS__);           \
+    check<microhal::CRC16_CCITT>("CRC16_CCITT" __VA_OPT__(, ) __VA_ARGS__);         \
+    check<microhal::CRC16_ARC>("CRC16_ARC" __VA_OPT__(, ) __VA_ARGS__);             \
+    check<microhal::CRC16_AUG_CCITT>("CRC16_AUG_CCITT" __VA_OPT__(, ) __VA_ARGS__); \
+    check<microhal::CRC16_BUYPASS>("CRC16_BUYPASS" __VA_OPT__(, ) __VA_ARGS__);     \
+    check<microhal::CRC16_DECT>("CRC16_DECT" __VA_OPT__(, ) __VA_ARGS__);           \
+    check<microhal::CRC16_CDMA2000>("CRC16_CDMA2000" __VA_OPT__(, ) __VA_ARGS__);   \
+    check<microhal::CRC16_DDS_110>("CRC16_DDS_110" __VA_OPT__(, ) __VA_ARGS__);     \
+    check<microhal::CRC16_DECT_R>("CRC16_DECT_R" __VA_OPT__(, ) __VA_ARGS__);       \
+    check<microhal::CRC16_DECT_X>("CRC16_DECT_X" __VA_OPT__(, ) __VA_ARGS__);       \
+    check<microhal::CRC16_DNP>("CRC16_DNP" __VA_OPT__(, ) __VA_ARGS__);             \
+    check<microhal::CRC16_EN_13757>("CRC16_EN_13757" __VA_OPT__(, ) __VA_ARGS__);   \
+    check<microhal::CRC16_GENIBUS>("CRC16_GENIBUS" __VA_OPT__(, ) __VA_ARGS__);     \
+    check<microhal::CRC16_MAXIM>("CRC16_MAXIM" __VA_OPT__(, ) __VA_ARGS__);         \
+    check<microhal::CRC16_MCRF4XX>("CRC16_MCRF4XX" __VA_OPT__(, ) __VA_ARGS__);     \
+    check<microhal::CRC16_RIELLO>("CRC16_RIELLO" __VA_OPT__(, ) __VA_ARGS__);       \
+    check<microhal::CRC16_T10_DIF>("CRC16_T10_DIF" __VA_OPT__(, ) __VA_ARGS__);     \
+    check<microhal::CRC16_TELEDISK>("CRC16_TELEDISK" __VA_OPT__(, ) __VA_ARGS__);   \
+    check<microhal::CRC16_TMS37157>("CRC16_TMS37157" __VA_OPT__(, ) __VA_ARGS__);   \
+    check<microhal::CRC16_USB>("CRC16_USB" __VA_OPT__(, ) __VA_ARGS__);             \
+    check<microhal::CRC16_A>("CRC16_A" __VA_OPT__(, ) __VA_ARGS__);                 \
+    check<microhal::CRC16_KERMIT>("CRC16_KERMIT" __VA_OPT__(, ) __VA_ARGS__);       \
+    check<microhal::CRC16_MODBUS>("CRC16_MODBUS" __VA_OPT__(, ) __VA_ARGS__);       \
+    check<microhal::CRC16_X_25>("CRC16_X_25" __VA_OPT__(, ) __VA_ARGS__);           \
+    check<microhal::CRC16_XMODEM>("CRC16_XMODEM" __VA_OPT__(, ) __VA_ARGS__);       \
+    check<microhal::CRC17_CAN>("CRC17_CAN" __VA_OPT__(, ) __VA_ARGS__);             \
+    check<microhal::CRC21_CAN>("CRC21_CAN" __VA_OPT__(, ) __VA_ARGS__);             \
+    check<microhal::CRC32>("CRC32" __VA_OPT__(, ) __VA_ARGS__);                     \
+    check<microhal::CRC32_BZIP2>("CRC32_BZIP2" __VA_OPT__(, ) __VA_ARGS__);         \
+    check<microhal::CRC32C>("CRC32C" __VA_OPT__(, ) __VA_ARGS__);                   \
+    check<microhal::CRC32D>("CRC32D" __VA_OPT__(, ) __VA_ARGS__);                   \
+    check<microhal::CRC32_MPEG_2>("CRC32_MPEG_2" __VA_OPT__(, ) __VA_ARGS__);       \
+    check<microhal::CRC32_POSIX>("CRC32_POSIX" __VA_OPT__(, ) __VA_ARGS__);         \
+    check<microhal::CRC32Q>("CRC32Q" __VA_OPT__(, ) __VA_ARGS__);                   \
+    check<microhal::CRC32_JAMCRC>("CRC32_JAMCRC" __VA_OPT__(, ) __VA_ARGS__);       \
+    check<microhal::CRC32_XFER>("CRC32_XFER" __VA_OPT__(, ) __VA_ARGS__)
+
+#endif /* _MICROHAL_CRC_PREDEFINED_CRC_LIST_H_ */
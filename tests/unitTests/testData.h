@@ -26,26 +26,29 @@
  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
-#include <chrono>
-#include <iostream>
+#ifndef _MICROHAL_CRC_TEST_DATA_H_
+#define _MICROHAL_CRC_TEST_DATA_H_
 
-#include "microhal-crc.hpp"
+#include <array>
+#include <cstdint>
+#include <span>
 
-using namespace microhal;
-
-#ifndef CRC_TYPE
-#error CRC_TYPE have to be defined, ie.: CRC7 or CRC16_CCITT
-#endif
-
-int main(void) {
-    std::array<uint8_t, 1'000'000> data;
-    data.fill(0xAA);
-
-    auto start = std::chrono::steady_clock::now();
-    for (size_t i = 100; i > 0; --i) {
-        [[maybe_unused]] volatile auto result = CRC_TYPE<Implementation::Table256>::calculate(data.data(), data.size());
+/**
+ * Fills data with pseudo random bytes from linear congruential generator, every call gives the same sequence.
+ */
+constexpr void fillTestData(std::span<uint8_t> data) {
+    uint32_t seed = 0x12345678;
+    for (auto &byte : data) {
+        seed = seed * 1664525 + 1013904223;
+        byte = uint8_t(seed >> 24);
     }
-    auto stop = std::chrono::steady_clock::now();
+}
 
-    std::cout << "execution time: " << std::chrono::nanoseconds{stop - start}.count() << "ns";
+template <size_t N>
+constexpr std::array<uint8_t, N> makeTestData() {
+    std::array<uint8_t, N> data{};
+    fillTestData(data);
+    return data;
 }
+
+#endif /* _MICROHAL_CRC_TEST_DATA_H_ */
@@ -0,0 +1,150 @@
+/**
+ * @license    BSD 3-Clause
+ * @brief      CRC library
+ *
+ * @authors    Pawel Okas
+ *
+ * @copyright Copyright (c) 2021, Pawel Okas
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+ * following conditions are met:
+ *
+ *     1. Redistributions of source code must retain the above copyright notice, this list of conditions and the
+ * following disclaimer.
+ *     2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ * following disclaimer in the documentation and/or other materials provided with the distribution.
+ *     3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote
+ * products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include <algorithm>
+#include <array>
+#include <vector>
+
+#include "doctest/doctest.h"
+#include "microhal-crc.hpp"
+#include "testData.h"
+
+using namespace microhal;
+
+constexpr auto implementation = Implementation::CRC_IMPLEMENTATION;
+
+static constexpr auto testdata = makeTestData<4099>();
+
+// Messages with different lengths, including empty messages, so lanes finish at different times.
+static std::vector<std::span<const uint8_t>> makeMessages() {
+    std::vector<std::span<const uint8_t>> messages;
+    size_t offset = 0;
+    for (size_t i = 0; i < 50; i++) {
+        const size_t length = (i % 7 == 3) ? 0 : (i * 97) % 300 + 1;
+        if (offset + length > testdata.size()) offset = i % 8;
+        messages.emplace_back(testdata.data() + offset, length);
+        offset += length;
+    }
+    return messages;
+}
+
+constexpr std::array<uint8_t, 9> check = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+
+TEST_CASE("Batch calculation of check string") {
+    // 9 messages, so the last one is calculated after the first group of lanes
+    std::vector<std::span<const uint8_t>> messages(9, check);
+    {
+        INFO("Checking CRC32C");
+        std::array<uint32_t, 9> out{};
+        CRC32C<implementation>::calculateBatch(messages, out);
+        CHECK(std::all_of(out.begin(), out.end(), [](uint32_t crc) { return crc == 0xE3069283; }));
+    }
+    {
+        INFO("Checking CRC32_MPEG_2");
+        std::array<uint32_t, 9> out{};
+        CRC32_MPEG_2<implementation>::calculateBatch(messages, out);
+        CHECK(std::all_of(out.begin(), out.end(), [](uint32_t crc) { return crc == 0x0376E6E7; }));
+    }
+    {
+        INFO("Checking CRC21_CAN");
+        std::array<uint32_t, 9> out{};
+        CRC21_CAN<implementation>::calculateBatch(messages, out);
+        CHECK(std::all_of(out.begin(), out.end(), [](uint32_t crc) { return crc == 0x0ED841; }));
+    }
+    {
+        INFO("Checking CRC16_X_25");
+        std::array<uint16_t, 9> out{};
+        CRC16_X_25<implementation>::calculateBatch(messages, out);
+        CHECK(std::all_of(out.begin(), out.end(), [](uint16_t crc) { return crc == 0x906E; }));
+    }
+    {
+        INFO("Checking CRC7");
+        std::array<uint8_t, 9> out{};
+        CRC7<implementation>::calculateBatch(messages, out);
+        CHECK(std::all_of(out.begin(), out.end(), [](uint8_t crc) { return crc == 0x75; }));
+    }
+}
+
+TEST_CASE("Batch calculation of messages with different lengths") {
+    const auto messages = makeMessages();
+    // lanes start and finish at different times, output after the last message is left untouched
+    for (size_t count : {size_t{0}, size_t{1}, size_t{7}, size_t{8}, size_t{9}, messages.size()}) {
+        {
+            INFO("Checking CRC32C, messages: " << count);
+            using Crc = CRC32C<implementation>;
+            std::vector<uint32_t> out(count + 1, 0x5A);
+            Crc::calculateBatch(std::span(messages).first(count), out);
+            for (size_t i = 0; i < count; i++) {
+                CHECK(out[i] == Crc::calculate(messages[i]));
+            }
+            CHECK(out[count] == 0x5A);
+        }
+        {
+            INFO("Checking CRC16_CCITT, messages: " << count);
+            using Crc = CRC16_CCITT<implementation>;
+            std::vector<uint16_t> out(count + 1, 0x5A);
+            Crc::calculateBatch(std::span(messages).first(count), out);
+            for (size_t i = 0; i < count; i++) {
+                CHECK(out[i] == Crc::calculate(messages[i]));
+            }
+            CHECK(out[count] == 0x5A);
+        }
+        {
+            INFO("Checking CRC5_USB, messages: " << count);
+            using Crc = CRC5_USB<implementation>;
+            std::vector<uint8_t> out(count + 1, 0x5A);
+            Crc::calculateBatch(std::span(messages).first(count), out);
+            for (size_t i = 0; i < count; i++) {
+                CHECK(out[i] == Crc::calculate(messages[i]));
+            }
+            CHECK(out[count] == 0x5A);
+        }
+    }
+}
+
+TEST_CASE("Batch calculation with too short output") {
+    const auto messages = makeMessages();
+    std::vector<uint32_t> out(messages.size() - 1);
+    CHECK_THROWS_AS(CRC32C<implementation>::calculateBatch(messages, out), std::invalid_argument);
+}
+
+TEST_CASE("Batch calculation of messages far apart in memory") {
+    // stack is far away from static data, so messages can't be addressed with 32 bit offsets from the first one
+    std::array<uint8_t, 300> local;
+    std::copy_n(testdata.begin() + 1000, local.size(), local.begin());
+    std::vector<std::span<const uint8_t>> messages;
+    for (size_t i = 0; i < 16; i++) {
+        const size_t length = 100 + i * 11;
+        messages.emplace_back(i % 2 ? local.data() + i : testdata.data() + i * 3, length);
+    }
+    using Crc = CRC32C<implementation>;
+    std::vector<uint32_t> out(messages.size());
+    Crc::calculateBatch(messages, out);
+    for (size_t i = 0; i < messages.size(); i++) {
+        CHECK(out[i] == Crc::calculate(messages[i]));
+    }
+}
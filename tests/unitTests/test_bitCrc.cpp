@@ -0,0 +1,135 @@
+/**
+ * @license    BSD 3-Clause
+ * @brief      CRC library
+ *
+ * @authors    Pawel Okas
+ *
+ * @copyright Copyright (c) 2021, Pawel Okas
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+ * following conditions are met:
+ *
+ *     1. Redistributions of source code must retain the above copyright notice, this list of conditions and the
+ * following disclaimer.
+ *     2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ * following disclaimer in the documentation and/or other materials provided with the distribution.
+ *     3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote
+ * products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <array>
+
+#include "doctest/doctest.h"
+#include "microhal-crc.hpp"
+
+using namespace microhal;
+
+constexpr auto implementation = Implementation::CRC_IMPLEMENTATION;
+
+// bit by bit CRC calculation straight from CRC parameters
+template <typename Crc>
+uint64_t referenceBits(std::span<const uint8_t> data, uint64_t bitCount) {
+    const size_t len = Crc::polynomialLength();
+    const uint64_t mask = len == 64 ? ~uint64_t{0} : (uint64_t{1} << len) - 1;
+    uint64_t remainder = Crc::initialValue();
+    for (uint64_t bit = 0; bit < bitCount; bit++) {
+        const uint8_t byte = data[bit / 8];
+        const bool dataBit = Crc::inputReflected() ? (byte >> (bit % 8)) & 1 : (byte >> (7 - bit % 8)) & 1;
+        const bool msb = ((remainder >> (len - 1)) & 1) != dataBit;
+        remainder = (remainder << 1) & mask;
+        if (msb) remainder ^= Crc::polynomial();
+    }
+    if (Crc::outputReflected()) remainder = crcDetail::reflect(remainder, len);
+    return remainder ^ Crc::xorOutValue();
+}
+
+constexpr std::array<uint8_t, 3> stream = {0xA5, 0xF0, 0x3C};
+constexpr std::array<uint8_t, 9> check = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+
+TEST_CASE("CRC of bit stream") {
+    {
+        INFO("Checking CRC3_GSM, 2 bits");
+        CHECK(CRC3_GSM<implementation>::calculateBits(stream, 2) == 0x6);
+    }
+    {
+        INFO("Checking CRC5_USB, 11 bits of token packet");
+        CHECK(CRC5_USB<implementation>::calculateBits(stream, 11) == 0x01);
+    }
+    {
+        INFO("Checking CRC7, 9 bits");
+        CHECK(CRC7<implementation>::calculateBits(check, 9) == 0x44);
+    }
+    {
+        INFO("Checking CRC8_MAXIM, 5 bits");
+        CHECK(CRC8_MAXIM<implementation>::calculateBits(stream, 5) == 0xE1);
+    }
+    {
+        INFO("Checking CRC16_CCITT, 20 bits");
+        CHECK(CRC16_CCITT<implementation>::calculateBits(stream, 20) == 0x29F2);
+    }
+    {
+        INFO("Checking CRC17_CAN, 12 bits");
+        CHECK(CRC17_CAN<implementation>::calculateBits(stream, 12) == 0x05A90);
+    }
+    {
+        INFO("Checking CRC21_CAN, 19 bits");
+        CHECK(CRC21_CAN<implementation>::calculateBits(stream, 19) == 0x0A3F4A);
+    }
+    {
+        INFO("Checking CRC32, 33 bits");
+        CHECK(CRC32<implementation>::calculateBits(check, 33) == 0xC32233A2);
+    }
+    {
+        INFO("Checking CRC32C, 71 bits");
+        CHECK(CRC32C<implementation>::calculateBits(check, 71) == 0xC60D2507);
+        CHECK(CRC32C<implementation>::calculateBits(check, 72) == 0xE3069283);
+        CHECK(CRC32C<implementation>::calculateBits(check, 0) == CRC32C<implementation>::calculate(check.data(), 0));
+    }
+}
+
+TEST_CASE("CRC of bit stream for every bit count") {
+    std::array<uint8_t, 40> message{};
+    for (size_t i = 0; i < message.size(); i++) {
+        message[i] = uint8_t(i * 37 + 11);
+    }
+    for (uint64_t bitCount = 0; bitCount <= message.size() * 8; bitCount++) {
+        {
+            INFO("Checking CRC7, bits: " << bitCount);
+            using Crc = CRC7<implementation>;
+            CHECK(Crc::calculateBits(message, bitCount) == referenceBits<Crc>(message, bitCount));
+        }
+        {
+            INFO("Checking CRC32C, bits: " << bitCount);
+            using Crc = CRC32C<implementation>;
+            CHECK(Crc::calculateBits(message, bitCount) == referenceBits<Crc>(message, bitCount));
+        }
+    }
+}
+
+TEST_CASE("CRC of bit stream longer than data") {
+    const std::array<uint8_t, 2> data = {0xA5, 0xF0};
+    using Crc = CRC17_CAN<implementation>;
+    CHECK_THROWS_AS(Crc::calculateBits(data, 17), std::invalid_argument);
+    CHECK_THROWS_AS(Crc::calculateBits(data, 24), std::invalid_argument);
+    CHECK_THROWS_AS(Crc::calculatePartialBits(Crc::initialize(), data, UINT64_MAX), std::invalid_argument);
+    CHECK_THROWS_AS(Crc::calculateBits(std::span(data).first(0), 1), std::invalid_argument);
+    CHECK(Crc::calculateBits(data, 16) == Crc::calculate(data.data(), data.size()));
+}
+
+TEST_CASE("CRC of bit stream at compile time") {
+    constexpr std::array<uint8_t, 2> data = {0xA5, 0xF0};
+    // CRC17_CAN starts from zero, so leading zero bits don't change it and 12 bits 1010 0101 1111 have the same CRC as
+    // 16 bits 0000 1010 0101 1111
+    constexpr std::array<uint8_t, 2> aligned = {0x0A, 0x5F};
+    using Crc = CRC17_CAN<implementation>;
+    static_assert(Crc::calculateBits(data, 12) == Crc::calculateBits(aligned, 16));
+}
@@ -0,0 +1,152 @@
+/**
+ * @license    BSD 3-Clause
+ * @brief      CRC library
+ *
+ * @authors    Pawel Okas
+ *
+ * @copyright Copyright (c) 2021, Pawel Okas
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+ * following conditions are met:
+ *
+ *     1. Redistributions of source code must retain the above copyright notice, this list of conditions and the
+ * following disclaimer.
+ *     2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ * following disclaimer in the documentation and/or other materials provided with the distribution.
+ *     3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote
+ * products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include <array>
+
+#include "doctest/doctest.h"
+#include "microhal-crc.hpp"
+
+using namespace microhal;
+
+constexpr auto implementation = Implementation::CRC_IMPLEMENTATION;
+
+// 0102030405060708090a0b0c0d0e0faabbccddeeff
+constexpr std::array<uint8_t, 21> testdata = {0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b,
+                                              0x0c, 0x0d, 0x0e, 0x0f, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff};
+constexpr std::array<uint8_t, 21> zeros = {};
+
+constexpr std::array<uint8_t, 9> check = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+constexpr auto head = std::span(check).first(4);
+constexpr auto tail = std::span(check).last(5);
+
+TEST_CASE("CRC combine") {
+    {
+        INFO("Checking CRC3_GSM");
+        using Crc = CRC3_GSM<implementation>;
+        CHECK(Crc::combine(Crc::calculate(head), Crc::calculate(tail), tail.size()) == 0x3);
+    }
+    {
+        INFO("Checking CRC5_USB");
+        using Crc = CRC5_USB<implementation>;
+        CHECK(Crc::combine(Crc::calculate(head), Crc::calculate(tail), tail.size()) == 0x04);
+    }
+    {
+        INFO("Checking CRC7");
+        using Crc = CRC7<implementation>;
+        CHECK(Crc::combine(Crc::calculate(head), Crc::calculate(tail), tail.size()) == 0x75);
+    }
+    {
+        INFO("Checking CRC8_CDMA2000");
+        using Crc = CRC8_CDMA2000<implementation>;
+        CHECK(Crc::combine(Crc::calculate(head), Crc::calculate(tail), tail.size()) == 0xDA);
+    }
+    {
+        INFO("Checking CRC16_CCITT");
+        using Crc = CRC16_CCITT<implementation>;
+        CHECK(Crc::combine(Crc::calculate(head), Crc::calculate(tail), tail.size()) == 0x29B1);
+    }
+    {
+        INFO("Checking CRC16_X_25");
+        using Crc = CRC16_X_25<implementation>;
+        CHECK(Crc::combine(Crc::calculate(head), Crc::calculate(tail), tail.size()) == 0x906E);
+    }
+    {
+        INFO("Checking CRC21_CAN");
+        using Crc = CRC21_CAN<implementation>;
+        CHECK(Crc::combine(Crc::calculate(head), Crc::calculate(tail), tail.size()) == 0x0ED841);
+    }
+    {
+        INFO("Checking CRC32");
+        using Crc = CRC32<implementation>;
+        CHECK(Crc::combine(Crc::calculate(head), Crc::calculate(tail), tail.size()) == 0x89A1897F);
+    }
+    {
+        INFO("Checking CRC32C");
+        using Crc = CRC32C<implementation>;
+        CHECK(Crc::combine(Crc::calculate(head), Crc::calculate(tail), tail.size()) == 0xE3069283);
+    }
+}
+
+TEST_CASE("CRC combine with empty message") {
+    using Crc = CRC16_X_25<implementation>;
+    const auto empty = std::span(check).first(0);
+    CHECK(Crc::combine(Crc::calculate(check), Crc::calculate(empty), 0) == 0x906E);
+    CHECK(Crc::combine(Crc::calculate(empty), Crc::calculate(check), check.size()) == 0x906E);
+}
+
+TEST_CASE("CRC combine at every split point") {
+    {
+        INFO("Checking CRC16_ARC");
+        using Crc = CRC16_ARC<implementation>;
+        for (size_t split = 0; split <= testdata.size(); split++) {
+            std::span<const uint8_t> partA(testdata.data(), split);
+            std::span<const uint8_t> partB(testdata.data() + split, testdata.size() - split);
+            CHECK(Crc::combine(Crc::calculate(partA), Crc::calculate(partB), partB.size()) == 0x322A);
+        }
+    }
+    {
+        INFO("Checking CRC17_CAN");
+        using Crc = CRC17_CAN<implementation>;
+        const auto expected = Crc::calculate(testdata);
+        for (size_t split = 0; split <= testdata.size(); split++) {
+            std::span<const uint8_t> partA(testdata.data(), split);
+            std::span<const uint8_t> partB(testdata.data() + split, testdata.size() - split);
+            CHECK(Crc::combine(Crc::calculate(partA), Crc::calculate(partB), partB.size()) == expected);
+        }
+    }
+}
+
+TEST_CASE("CRC shift by zeros") {
+    {
+        INFO("Checking CRC8_ROHC");
+        using Crc = CRC8_ROHC<implementation>;
+        const auto remainder = Crc::calculatePartial(Crc::initialize(), testdata);
+        for (size_t length = 0; length <= zeros.size(); length++) {
+            CHECK(Crc::shift(remainder, length) == Crc::calculatePartial(remainder, zeros.data(), length));
+        }
+    }
+    {
+        INFO("Checking CRC32_MPEG_2");
+        using Crc = CRC32_MPEG_2<implementation>;
+        const auto remainder = Crc::calculatePartial(Crc::initialize(), testdata);
+        for (size_t length = 0; length <= zeros.size(); length++) {
+            CHECK(Crc::shift(remainder, length) == Crc::calculatePartial(remainder, zeros.data(), length));
+        }
+    }
+}
+
+TEST_CASE("CRC combine of long messages") {
+    // CRC of messages containing only zeros, calculated without processing the data
+    using Crc = CRC32<implementation>;
+    constexpr auto zerosCrc = [](uint64_t length) { return Crc::finalize(Crc::shift(Crc::initialize(), length)); };
+    constexpr uint64_t length = 500'000'000;
+    static_assert(Crc::combine(zerosCrc(length), zerosCrc(length), length) == zerosCrc(2 * length));
+    CHECK(zerosCrc(zeros.size()) == Crc::calculate(zeros));
+
+    static_assert(CRC32C<implementation>::combine(CRC32C<implementation>::calculate(head),
+                                                  CRC32C<implementation>::calculate(tail), 5) == 0xE3069283);
+}
@@ -0,0 +1,134 @@
+/**
+ * @license    BSD 3-Clause
+ * @brief      CRC library
+ *
+ * @authors    Pawel Okas
+ *
+ * @copyright Copyright (c) 2021, Pawel Okas
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+ * following conditions are met:
+ *
+ *     1. Redistributions of source code must retain the above copyright notice, this list of conditions and the
+ * following disclaimer.
+ *     2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ * following disclaimer in the documentation and/or other materials provided with the distribution.
+ *     3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote
+ * products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <vector>
+
+#include "doctest/doctest.h"
+#include "microhal-crc.hpp"
+
+using namespace microhal;
+
+constexpr auto implementation = Implementation::CRC_IMPLEMENTATION;
+
+constexpr std::array<size_t, 9> sizes = {0, 1, 15, 16, 17, 1000, 16 * 1024, 16 * 1024 + 3, 100'000};
+
+constexpr std::array<uint8_t, 9> check = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+
+// copies size bytes between buffers misaligned by offset and compares CRC with CRC of source
+template <typename Crc>
+void checkCopy(size_t size, size_t offset) {
+    INFO("size: " << size << ", offset: " << offset);
+    std::vector<uint8_t> source(size + offset);
+    for (size_t i = 0; i < source.size(); i++) {
+        source[i] = uint8_t(i * 7 + (i >> 8));
+    }
+    std::vector<uint8_t> destination(size + offset + 1, 0x55);
+    const auto src = std::span<const uint8_t>(source).subspan(offset);
+    const auto dst = std::span<uint8_t>(destination).subspan(offset, size);
+    CHECK(Crc::copyAndCalculate(dst, src) == Crc::calculate(src));
+    CHECK(std::equal(src.begin(), src.end(), dst.begin()));
+    CHECK(destination.back() == 0x55);
+
+    const auto init = Crc::calculatePartial(Crc::initialize(), src.first(size / 2));
+    CHECK(Crc::copyAndCalculatePartial(init, dst.subspan(size / 2), src.subspan(size / 2)) ==
+          Crc::calculatePartial(Crc::initialize(), src));
+}
+
+TEST_CASE("Copy and calculate") {
+    {
+        INFO("Checking CRC7");
+        std::array<uint8_t, 9> destination{};
+        CHECK(CRC7<implementation>::copyAndCalculate(destination, check) == 0x75);
+        CHECK(destination == check);
+    }
+    {
+        INFO("Checking CRC16_X_25");
+        std::array<uint8_t, 9> destination{};
+        CHECK(CRC16_X_25<implementation>::copyAndCalculate(destination, check) == 0x906E);
+        CHECK(destination == check);
+    }
+    {
+        INFO("Checking CRC21_CAN");
+        std::array<uint8_t, 9> destination{};
+        CHECK(CRC21_CAN<implementation>::copyAndCalculate(destination, check) == 0x0ED841);
+        CHECK(destination == check);
+    }
+    {
+        INFO("Checking CRC32C");
+        std::array<uint8_t, 9> destination{};
+        CHECK(CRC32C<implementation>::copyAndCalculate(destination, check) == 0xE3069283);
+        CHECK(destination == check);
+    }
+}
+
+TEST_CASE("Copy and calculate of unaligned buffers") {
+    for (auto size : sizes) {
+        for (size_t offset = 0; offset < 4; offset++) {
+            {
+                INFO("Checking CRC8_MAXIM");
+                checkCopy<CRC8_MAXIM<implementation>>(size, offset);
+            }
+            {
+                INFO("Checking CRC16_CCITT");
+                checkCopy<CRC16_CCITT<implementation>>(size, offset);
+            }
+            {
+                INFO("Checking CRC32C");
+                checkCopy<CRC32C<implementation>>(size, offset);
+            }
+        }
+    }
+}
+
+TEST_CASE("Copy and calculate with non-temporal stores") {
+    using Crc = CRC32C<implementation>;
+    const size_t size = Crc::CopyNonTemporalThreshold + 5;
+    for (size_t offset = 0; offset < 3; offset++) {
+        checkCopy<Crc>(size, offset);
+    }
+}
+
+TEST_CASE("Copy and calculate with too short destination") {
+    using Crc = CRC32C<implementation>;
+    std::array<uint8_t, 9> destination = {};
+    CHECK_THROWS_AS(Crc::copyAndCalculate(std::span(destination).first(8), check), std::invalid_argument);
+    CHECK_THROWS_AS(Crc::copyAndCalculatePartial(Crc::initialize(), std::span(destination).first(0), check),
+                    std::invalid_argument);
+    CHECK(std::all_of(destination.begin(), destination.end(), [](uint8_t byte) { return byte == 0; }));
+    CHECK(Crc::copyAndCalculate(destination, check) == 0xE3069283);
+}
+
+TEST_CASE("Copy and calculate at compile time") {
+    constexpr auto crc = [] {
+        std::array<uint8_t, 9> source = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+        std::array<uint8_t, 9> destination{};
+        const auto result = CRC32_MPEG_2<implementation>::copyAndCalculate(destination, source);
+        return destination == source ? result : 0;
+    }();
+    static_assert(crc == 0x0376E6E7);
+}
@@ -54,5 +54,6 @@ TEST_CASE("CRC16 'x^16 + x^12 + x^5 + 1' used in SD Card") {
         data.fill(0xFF);
         uint16_t crc_calculated = CRC16_XMODEM<implementation>::calculate(data);
         CHECK(crc_calculated == 0x7FA1);
+        CHECK(CRC16_XMODEM<implementation>::calculate(data.data(), data.size()) == 0x7FA1);
     }
 }
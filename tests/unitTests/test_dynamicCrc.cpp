@@ -0,0 +1,107 @@
+/**
+ * @license    BSD 3-Clause
+ * @brief      CRC library
+ *
+ * @authors    Pawel Okas
+ *
+ * @copyright Copyright (c) 2021, Pawel Okas
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+ * following conditions are met:
+ *
+ *     1. Redistributions of source code must retain the above copyright notice, this list of conditions and the
+ * following disclaimer.
+ *     2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ * following disclaimer in the documentation and/or other materials provided with the distribution.
+ *     3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote
+ * products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include <array>
+
+#include "doctest/doctest.h"
+#include "microhal-crc-dynamic.hpp"
+#include "predefinedCrcList.h"
+
+using namespace microhal;
+
+constexpr auto implementation = Implementation::CRC_IMPLEMENTATION;
+
+// 0102030405060708090a0b0c0d0e0faabbccddeeff
+constexpr std::array<uint8_t, 21> testdata = {0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b,
+                                              0x0c, 0x0d, 0x0e, 0x0f, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff};
+constexpr std::array<uint8_t, 9> check = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+
+template <template <Implementation> class CRC>
+void checkDynamic(const char *name) {
+    INFO(name);
+    using Reference = CRC<implementation>;
+    const auto crc = DynamicCRC::from<Reference>();
+    CHECK(crc.calculate(testdata) == Reference::calculate(testdata));
+    CHECK(crc.calculate(check) == Reference::calculate(check));
+    const auto part = crc.calculatePartial(crc.initialize(), std::span(testdata).first(5));
+    CHECK(crc.finalize(crc.calculatePartial(part, std::span(testdata).subspan(5))) == Reference::calculate(testdata));
+}
+
+TEST_CASE("Dynamic CRC consistency with predefined CRC") {
+    FOR_EACH_PREDEFINED_CRC(checkDynamic);
+}
+
+TEST_CASE("Dynamic CRC64") {
+    {
+        INFO("Checking CRC64_ECMA_182");
+        DynamicCRC crc({.width = 64, .polynomial = 0x42F0E1EBA9EA3693});
+        CHECK(crc.calculate(check) == 0x6C40DF5F0B497347);
+    }
+    {
+        INFO("Checking CRC64_XZ");
+        DynamicCRC crc({.width = 64,
+                        .polynomial = 0x42F0E1EBA9EA3693,
+                        .initial = 0xFFFFFFFFFFFFFFFF,
+                        .xorOut = 0xFFFFFFFFFFFFFFFF,
+                        .reflectIn = true,
+                        .reflectOut = true});
+        CHECK(crc.calculate(check) == 0x995DC9BBDF1939FA);
+    }
+}
+
+TEST_CASE("Dynamic CRC table cache") {
+    // CRCs with the same polynomial, width and input reflection share one table
+    const auto crc32Mpeg2 = DynamicCRC::from<CRC32_MPEG_2<>>();
+    const auto crc32Bzip2 = DynamicCRC::from<CRC32_BZIP2<>>();
+    const auto crc32Posix = DynamicCRC::from<CRC32_POSIX<>>();
+    CHECK(crc32Bzip2.calculate(check) == 0xFC891918);
+    CHECK(crc32Posix.calculate(check) == 0x765E7680);
+    CHECK(crc32Mpeg2.calculate(check) == 0x0376E6E7);
+    CHECK(&crc32Bzip2.getTable() == &crc32Mpeg2.getTable());
+    CHECK(&crc32Posix.getTable() == &crc32Mpeg2.getTable());
+
+    // the same polynomial with reflected input or different width needs another table
+    const auto crc32Jamcrc = DynamicCRC::from<CRC32_JAMCRC<>>();
+    const auto crc33 = DynamicCRC({.width = 33, .polynomial = 0x04C11DB7});
+    CHECK(&crc32Jamcrc.getTable() != &crc32Mpeg2.getTable());
+    CHECK(&crc33.getTable() != &crc32Mpeg2.getTable());
+    CHECK(&crc33.getTable() != &crc32Jamcrc.getTable());
+}
+
+TEST_CASE("Dynamic CRC invalid parameters") {
+    CHECK_THROWS_AS((DynamicCRC({.width = 0, .polynomial = 0x07})), std::invalid_argument);
+    CHECK_THROWS_AS((DynamicCRC({.width = 65, .polynomial = 0x07})), std::invalid_argument);
+    CHECK_THROWS_AS((DynamicCRC({.width = 8, .polynomial = 0x107})), std::invalid_argument);
+    CHECK_THROWS_AS((DynamicCRC({.width = 8, .polynomial = 0x07, .initial = 0x1FF})), std::invalid_argument);
+    CHECK_THROWS_AS((DynamicCRC({.width = 16, .polynomial = 0x1021, .xorOut = 0x10000})), std::invalid_argument);
+    CHECK_THROWS_AS((DynamicCRC({.width = 5, .polynomial = 0x15, .initial = 0x1F, .xorOut = 0x20})),
+                    std::invalid_argument);
+    // CRC5_USB
+    DynamicCRC crc5(
+        {.width = 5, .polynomial = 0x05, .initial = 0x1F, .xorOut = 0x1F, .reflectIn = true, .reflectOut = true});
+    CHECK(crc5.calculate(check) == 0x19);
+}
@@ -0,0 +1,131 @@
+/**
+ * @license    BSD 3-Clause
+ * @brief      CRC library
+ *
+ * @authors    Pawel Okas
+ *
+ * @copyright Copyright (c) 2021, Pawel Okas
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+ * following conditions are met:
+ *
+ *     1. Redistributions of source code must retain the above copyright notice, this list of conditions and the
+ * following disclaimer.
+ *     2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ * following disclaimer in the documentation and/or other materials provided with the distribution.
+ *     3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote
+ * products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "doctest/doctest.h"
+#include "microhal-crc.hpp"
+
+using namespace microhal;
+
+constexpr auto implementation = Implementation::CRC_IMPLEMENTATION;
+
+constexpr auto makeData() {
+    std::array<uint8_t, 80> data{};
+    for (size_t i = 0; i < data.size(); i++) {
+        data[i] = uint8_t(i * 53 + 7);
+    }
+    return data;
+}
+
+constexpr auto data = makeData();
+
+// checks every length below and above FixedLengthUnrollLimit against calculation of data with runtime length
+template <typename Crc>
+void checkEveryLength() {
+    [&]<size_t... N>(std::index_sequence<N...>) {
+        (
+            [&] {
+                INFO("length: " << N);
+                std::array<uint8_t, N> fixed{};
+                std::copy_n(data.begin(), N, fixed.begin());
+                const auto expected = Crc::calculate(data.data(), N);
+                CHECK(Crc::calculate(fixed) == expected);
+                CHECK(Crc::calculate(std::span<const uint8_t, N>(data.data(), N)) == expected);
+            }(),
+            ...);
+    }(std::make_index_sequence<data.size()>{});
+}
+
+constexpr std::array<uint8_t, 9> check = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+
+TEST_CASE("Fixed length CRC") {
+    {
+        INFO("Checking CRC3_GSM");
+        CHECK(CRC3_GSM<implementation>::calculate(check) == 0x3);
+    }
+    {
+        INFO("Checking CRC5_USB");
+        CHECK(CRC5_USB<implementation>::calculate(check) == 0x04);
+    }
+    {
+        INFO("Checking CRC7");
+        CHECK(CRC7<implementation>::calculate(check) == 0x75);
+    }
+    {
+        INFO("Checking CRC8_ROHC");
+        CHECK(CRC8_ROHC<implementation>::calculate(check) == 0xD0);
+    }
+    {
+        INFO("Checking CRC16_ARC");
+        CHECK(CRC16_ARC<implementation>::calculate(check) == 0xBB3D);
+    }
+    {
+        INFO("Checking CRC16_CCITT");
+        CHECK(CRC16_CCITT<implementation>::calculate(check) == 0x29B1);
+    }
+    {
+        INFO("Checking CRC17_CAN");
+        CHECK(CRC17_CAN<implementation>::calculate(check) == 0x04F03);
+    }
+    {
+        INFO("Checking CRC32_XFER");
+        CHECK(CRC32_XFER<implementation>::calculate(check) == 0xBD0BE338);
+    }
+    {
+        INFO("Checking CRC32C");
+        CHECK(CRC32C<implementation>::calculate(check) == 0xE3069283);
+    }
+}
+
+TEST_CASE("Fixed length CRC of every length") {
+    {
+        INFO("Checking CRC7");
+        checkEveryLength<CRC7<implementation>>();
+    }
+    {
+        INFO("Checking CRC16_X_25");
+        checkEveryLength<CRC16_X_25<implementation>>();
+    }
+    {
+        INFO("Checking CRC32_MPEG_2");
+        checkEveryLength<CRC32_MPEG_2<implementation>>();
+    }
+    {
+        INFO("Checking CRC32C");
+        checkEveryLength<CRC32C<implementation>>();
+    }
+}
+
+TEST_CASE("Fixed length CRC of SD card command") {
+    constexpr std::array<uint8_t, 5> cmd0 = {0b0100'0000, 0x00, 0x00, 0x00, 0x00};
+    static_assert(CRC7<implementation>::calculate(cmd0) == 0b100'1010);
+
+    const std::array<uint8_t, 5> cmd17 = {0b0101'0001, 0x00, 0x00, 0x00, 0x00};
+    CHECK(CRC7<implementation>::calculate(cmd17) == 0b010'1010);
+    const std::array<uint8_t, 5> response = {0b0001'0001, 0x00, 0x00, 0x09, 0x00};
+    CHECK(CRC7<implementation>::calculate(std::span(response)) == 0b011'0011);
+}
@@ -0,0 +1,138 @@
+/**
+ * @license    BSD 3-Clause
+ * @brief      CRC library
+ *
+ * @authors    Pawel Okas
+ *
+ * @copyright Copyright (c) 2021, Pawel Okas
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+ * following conditions are met:
+ *
+ *     1. Redistributions of source code must retain the above copyright notice, this list of conditions and the
+ * following disclaimer.
+ *     2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ * following disclaimer in the documentation and/or other materials provided with the distribution.
+ *     3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote
+ * products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <vector>
+
+#include "doctest/doctest.h"
+#include "microhal-crc.hpp"
+
+using namespace microhal;
+
+constexpr auto implementation = Implementation::CRC_IMPLEMENTATION;
+
+constexpr std::array<uint8_t, 3> prefix = {0x01, 0x02, 0x03};
+
+// splits data into fragments with lengths taken from pattern, pattern is repeated until data ends
+std::vector<std::span<const uint8_t>> split(std::span<const uint8_t> data, std::span<const size_t> pattern) {
+    std::vector<std::span<const uint8_t>> fragments;
+    for (size_t offset = 0, i = 0; offset < data.size(); i++) {
+        const size_t length = std::min(pattern[i % pattern.size()], data.size() - offset);
+        fragments.push_back(data.subspan(offset, length));
+        offset += length;
+    }
+    return fragments;
+}
+
+// compares CRC of data split into fragments by every pattern with CRC of contiguous data
+template <typename Crc>
+void checkFragmented(std::span<const uint8_t> data) {
+    constexpr std::array<size_t, 3> headerPayloadTrailer = {14, 4096, 4};
+    constexpr std::array<size_t, 5> tiny = {1, 0, 3, 2, 7};
+    constexpr std::array<size_t, 4> mixed = {5, 1500, 63, 64};
+    constexpr std::array<size_t, 1> whole = {100'000};
+    const std::array<std::span<const size_t>, 4> patterns = {headerPayloadTrailer, tiny, mixed, whole};
+    for (size_t i = 0; i < patterns.size(); i++) {
+        INFO("size: " << data.size() << ", pattern: " << i);
+        const auto fragments = split(data, patterns[i]);
+        CHECK(Crc::calculate(fragments) == Crc::calculate(data));
+        const auto init = Crc::calculatePartial(Crc::initialize(), prefix);
+        CHECK(Crc::calculatePartial(init, fragments) == Crc::calculatePartial(init, data));
+#if __has_include(<sys/uio.h>)
+        std::vector<iovec> iov;
+        for (auto fragment : fragments) {
+            iov.push_back({const_cast<uint8_t *>(fragment.data()), fragment.size()});
+        }
+        CHECK(Crc::calculate(iov) == Crc::calculate(data));
+#endif
+    }
+}
+
+constexpr std::array<uint8_t, 9> check = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+
+TEST_CASE("CRC of fragmented check string") {
+    const auto message = std::span(check);
+    // "12", "", "3456", "789"
+    const std::array<std::span<const uint8_t>, 4> fragments = {message.first(2), message.first(0),
+                                                               message.subspan(2, 4), message.last(3)};
+    {
+        INFO("Checking CRC5_USB");
+        CHECK(CRC5_USB<implementation>::calculate(fragments) == 0x04);
+    }
+    {
+        INFO("Checking CRC8_CDMA2000");
+        CHECK(CRC8_CDMA2000<implementation>::calculate(fragments) == 0xDA);
+    }
+    {
+        INFO("Checking CRC16_X_25");
+        CHECK(CRC16_X_25<implementation>::calculate(fragments) == 0x906E);
+    }
+    {
+        INFO("Checking CRC32C");
+        CHECK(CRC32C<implementation>::calculate(fragments) == 0xE3069283);
+    }
+#if __has_include(<sys/uio.h>)
+    {
+        INFO("Checking CRC32C of iovec");
+        std::array<iovec, 4> iov;
+        for (size_t i = 0; i < fragments.size(); i++) {
+            iov[i] = {const_cast<uint8_t *>(fragments[i].data()), fragments[i].size()};
+        }
+        CHECK(CRC32C<implementation>::calculate(iov) == 0xE3069283);
+    }
+#endif
+}
+
+TEST_CASE("CRC of fragmented message") {
+    std::vector<uint8_t> data(20'000);
+    for (size_t i = 0; i < data.size(); i++) {
+        data[i] = uint8_t(i * 13 + (i >> 9));
+    }
+    for (size_t size : {size_t{0}, size_t{1}, size_t{100}, size_t{5000}, data.size()}) {
+        const auto message = std::span<const uint8_t>(data).first(size);
+        {
+            INFO("Checking CRC7");
+            checkFragmented<CRC7<implementation>>(message);
+        }
+        {
+            INFO("Checking CRC16_CCITT");
+            checkFragmented<CRC16_CCITT<implementation>>(message);
+        }
+        {
+            INFO("Checking CRC32C");
+            checkFragmented<CRC32C<implementation>>(message);
+        }
+    }
+}
+
+constexpr std::array<uint8_t, 4> first = {'1', '2', '3', '4'};
+constexpr std::array<uint8_t, 5> second = {'5', '6', '7', '8', '9'};
+
+TEST_CASE("CRC of fragmented message at compile time") {
+    constexpr std::array<std::span<const uint8_t>, 3> fragments = {first, {}, second};
+    static_assert(CRC32_MPEG_2<implementation>::calculate(fragments) == 0x0376E6E7);
+}
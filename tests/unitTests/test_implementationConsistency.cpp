@@ -0,0 +1,102 @@
+/**
+ * @license    BSD 3-Clause
+ * @brief      CRC library
+ *
+ * @authors    Pawel Okas
+ *
+ * @copyright Copyright (c) 2021, Pawel Okas
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+ * following conditions are met:
+ *
+ *     1. Redistributions of source code must retain the above copyright notice, this list of conditions and the
+ * following disclaimer.
+ *     2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ * following disclaimer in the documentation and/or other materials provided with the distribution.
+ *     3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote
+ * products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <array>
+#include <vector>
+
+#include "doctest/doctest.h"
+#include "microhal-crc.hpp"
+#include "predefinedCrcList.h"
+#include "testData.h"
+
+using namespace microhal;
+
+constexpr auto implementation = Implementation::CRC_IMPLEMENTATION;
+
+static constexpr auto testdata = makeTestData<4099>();
+
+constexpr std::array<size_t, 8> longLengths = {255, 256, 257, 511, 1000, 1024, 4096, 4099};
+
+// Bit shift implementation is used as reference, every implementation have to give the same result for every message
+// length and for every offset of message in memory.
+template <template <Implementation> class CRC>
+void checkAgainstBitShift(const char *name) {
+    INFO(name);
+    using Reference = CRC<Implementation::BitShift>;
+    using Tested = CRC<implementation>;
+    for (size_t length = 0; length < 200; length++) {
+        for (size_t offset = 0; offset < 8; offset++) {
+            std::span<const uint8_t> message(testdata.data() + offset, length);
+            CHECK(Tested::calculate(message) == Reference::calculate(message));
+        }
+    }
+    for (auto length : longLengths) {
+        std::span<const uint8_t> message(testdata.data(), length);
+        CHECK(Tested::calculate(message) == Reference::calculate(message));
+    }
+}
+
+TEST_CASE("Implementation consistency with BitShift implementation") {
+    FOR_EACH_PREDEFINED_CRC(checkAgainstBitShift);
+}
+
+// Hardware implementations use different code paths for blocks of several kilobytes, so they are checked with messages
+// longer than testdata.
+template <template <Implementation> class CRC>
+void checkLongMessages(const char *name) {
+    INFO(name);
+    using Reference = CRC<Implementation::Table256>;
+    using Tested = CRC<implementation>;
+    std::vector<uint8_t> data(3 * 8192 + 3 * 256 + 64);
+    for (size_t i = 0; i < data.size(); i++) {
+        data[i] = testdata[i % testdata.size()];
+    }
+    for (size_t length : {size_t{3 * 8192 - 1}, size_t{3 * 8192}, size_t{3 * 8192 + 3 * 256 + 15}}) {
+        for (size_t offset = 0; offset < 3; offset++) {
+            std::span<const uint8_t> message(data.data() + offset, length);
+            CHECK(Tested::calculate(message) == Reference::calculate(message));
+        }
+    }
+}
+
+TEST_CASE("Implementation consistency for long messages") {
+    FOR_EACH_PREDEFINED_CRC(checkLongMessages);
+}
+
+TEST_CASE("Compile time calculation") {
+    constexpr std::array<uint8_t, 9> check = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+    static_assert(CRC32C<implementation>::calculate(check) == 0xE3069283);
+    static_assert(CRC16_ARC<implementation>::calculate(check) == 0xBB3D);
+    static_assert(CRC17_CAN<implementation>::calculate(check) == 0x04F03);
+    static_assert(CRC21_CAN<implementation>::calculate(check) == 0x0ED841);
+    // long enough to use block processing of word based implementations
+    constexpr auto message = std::span(testdata).first(200);
+    static_assert(CRC32<implementation>::calculate(message) == CRC32<Implementation::BitShift>::calculate(message));
+    static_assert(CRC32C<implementation>::calculate(message) == CRC32C<Implementation::BitShift>::calculate(message));
+    static_assert(CRC7<implementation>::calculate(message) == CRC7<Implementation::BitShift>::calculate(message));
+}
@@ -0,0 +1,114 @@
+/**
+ * @license    BSD 3-Clause
+ * @brief      CRC library
+ *
+ * @authors    Pawel Okas
+ *
+ * @copyright Copyright (c) 2021, Pawel Okas
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+ * following conditions are met:
+ *
+ *     1. Redistributions of source code must retain the above copyright notice, this list of conditions and the
+ * following disclaimer.
+ *     2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ * following disclaimer in the documentation and/or other materials provided with the distribution.
+ *     3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote
+ * products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <vector>
+
+#include "doctest/doctest.h"
+#include "microhal-crc.hpp"
+
+using namespace microhal;
+
+constexpr auto implementation = Implementation::CRC_IMPLEMENTATION;
+
+TEST_CASE("Multiple CRCs in one pass") {
+    std::vector<uint8_t> data(20'000);
+    for (size_t i = 0; i < data.size(); i++) {
+        data[i] = uint8_t(i * 17 + (i >> 6));
+    }
+    using Crc32 = CRC32<implementation>;
+    using Crc32C = CRC32C<implementation>;
+    using Crc16 = CRC16_X_25<implementation>;
+    using Crc7 = CRC7<implementation>;
+    using Multi = MultiCRC<Crc32, Crc32C, Crc16, Crc7>;
+    for (size_t size : {size_t{0}, size_t{1}, size_t{100}, Multi::ChunkSize, Multi::ChunkSize + 1, data.size()}) {
+        INFO("size: " << size);
+        const auto message = std::span<const uint8_t>(data).first(size);
+        const auto [crc32, crc32c, crc16, crc7] = Multi::calculate(message);
+        CHECK(crc32 == Crc32::calculate(message));
+        CHECK(crc32c == Crc32C::calculate(message));
+        CHECK(crc16 == Crc16::calculate(message));
+        CHECK(crc7 == Crc7::calculate(message));
+
+        const auto [partial32, partial16] = MultiCRC<Crc32, Crc16>::calculatePartial(
+            MultiCRC<Crc32, Crc16>::calculatePartial(MultiCRC<Crc32, Crc16>::initialize(), message.first(size / 3)),
+            message.subspan(size / 3));
+        CHECK(partial32 == Crc32::calculatePartial(Crc32::initialize(), message));
+        CHECK(partial16 == Crc16::calculatePartial(Crc16::initialize(), message));
+    }
+}
+
+TEST_CASE("Multiple CRCs of different ranges") {
+    std::vector<uint8_t> data(20'000);
+    for (size_t i = 0; i < data.size(); i++) {
+        data[i] = uint8_t(i * 17 + (i >> 6));
+    }
+    const auto message = std::span<const uint8_t>(data);
+    // Table256 and Slice4Lsb CRCs are calculated in lockstep with each other, CRC32 with every implementation
+    using Crc16 = CRC16_CCITT<Implementation::Table256>;
+    using Crc32 = CRC32<implementation>;
+    using Crc32C = CRC32C<Implementation::Slice4Lsb>;
+    using Multi = MultiCRC<Crc16, Crc32, Crc32C>;
+
+    // CRC16 of header, CRC32 of header and payload and CRC32C of payload
+    auto [crc16, crc32, crc32c] = Multi::calculate(message, {{{0, 14}, {0, 10'003}, {14, 9'989}}});
+    CHECK(crc16 == Crc16::calculate(message.first(14)));
+    CHECK(crc32 == Crc32::calculate(message.first(10'003)));
+    CHECK(crc32c == Crc32C::calculate(message.subspan(14, 9'989)));
+
+    // ranges that start and end in different chunks
+    std::tie(crc16, crc32, crc32c) = Multi::calculate(message, {{{5'000, 15'000}, {3, 19'990}, {4'095, 8'195}}});
+    CHECK(crc16 == Crc16::calculate(message.subspan(5'000, 15'000)));
+    CHECK(crc32 == Crc32::calculate(message.subspan(3, 19'990)));
+    CHECK(crc32c == Crc32C::calculate(message.subspan(4'095, 8'195)));
+
+    // disjoint and empty ranges
+    std::tie(crc16, crc32, crc32c) = Multi::calculate(message, {{{0, 100}, {20'000, 0}, {10'000, 10'000}}});
+    CHECK(crc16 == Crc16::calculate(message.first(100)));
+    CHECK(crc32 == Crc32::calculate(message.first(0)));
+    CHECK(crc32c == Crc32C::calculate(message.last(10'000)));
+}
+
+TEST_CASE("Multiple CRCs with invalid range") {
+    const std::array<uint8_t, 10> data = {};
+    using Multi = MultiCRC<CRC16_CCITT<implementation>, CRC32<implementation>>;
+    CHECK_THROWS_AS(Multi::calculate(data, {{{0, 10}, {0, 11}}}), std::invalid_argument);
+    CHECK_THROWS_AS(Multi::calculate(data, {{{11, 0}, {0, 10}}}), std::invalid_argument);
+    CHECK_THROWS_AS(Multi::calculate(data, {{{1, SIZE_MAX}, {0, 10}}}), std::invalid_argument);
+}
+
+constexpr std::array<uint8_t, 9> check = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+
+TEST_CASE("Multiple CRCs at compile time") {
+    constexpr auto checksums = MultiCRC<CRC32_MPEG_2<implementation>, CRC32C<implementation>>::calculate(check);
+    static_assert(std::get<0>(checksums) == 0x0376E6E7);
+    static_assert(std::get<1>(checksums) == 0xE3069283);
+    constexpr auto prefixes =
+        MultiCRC<CRC32_MPEG_2<implementation>, CRC32C<implementation>>::calculate(check, {{{0, 4}, {2, 7}}});
+    static_assert(std::get<0>(prefixes) == CRC32_MPEG_2<implementation>::calculate(check.data(), 4));
+    static_assert(std::get<1>(prefixes) == CRC32C<implementation>::calculate(check.data() + 2, 7));
+}
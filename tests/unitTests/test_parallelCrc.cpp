@@ -0,0 +1,77 @@
+/**
+ * @license    BSD 3-Clause
+ * @brief      CRC library
+ *
+ * @authors    Pawel Okas
+ *
+ * @copyright Copyright (c) 2021, Pawel Okas
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+ * following conditions are met:
+ *
+ *     1. Redistributions of source code must retain the above copyright notice, this list of conditions and the
+ * following disclaimer.
+ *     2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ * following disclaimer in the documentation and/or other materials provided with the distribution.
+ *     3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote
+ * products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include <vector>
+
+#include "doctest/doctest.h"
+#include "microhal-crc.hpp"
+#include "testData.h"
+
+using namespace microhal;
+
+constexpr auto implementation = Implementation::CRC_IMPLEMENTATION;
+
+#if defined(__STDCPP_THREADS__)
+TEST_CASE("Parallel calculation") {
+    std::vector<uint8_t> data(3 * 1024 * 1024 + 3);
+    fillTestData(data);
+    // data shorter than minimal slice size is calculated by calling thread
+    const std::span<const uint8_t> shortData(data.data(), 1000);
+    // 4 threads are limited to 3 by slice size
+    {
+        INFO("Checking CRC32C");
+        using Crc = CRC32C<implementation>;
+        const auto expected = Crc::calculate(data);
+        CHECK(Crc::calculateParallel(data, 2) == expected);
+        CHECK(Crc::calculateParallel(data, 3) == expected);
+        CHECK(Crc::calculateParallel(data, 4) == expected);
+        CHECK(Crc::calculateParallel(shortData, 4) == Crc::calculate(shortData));
+    }
+    {
+        INFO("Checking CRC32_MPEG_2");
+        using Crc = CRC32_MPEG_2<implementation>;
+        const auto expected = Crc::calculate(data);
+        CHECK(Crc::calculateParallel(data, 2) == expected);
+        CHECK(Crc::calculateParallel(data, 3) == expected);
+        CHECK(Crc::calculateParallel(shortData, 4) == Crc::calculate(shortData));
+    }
+    {
+        INFO("Checking CRC16_X_25");
+        using Crc = CRC16_X_25<implementation>;
+        const auto expected = Crc::calculate(data);
+        CHECK(Crc::calculateParallel(data, 2) == expected);
+        CHECK(Crc::calculateParallel(data, 4) == expected);
+    }
+    {
+        INFO("Checking CRC7");
+        using Crc = CRC7<implementation>;
+        const auto expected = Crc::calculate(data);
+        CHECK(Crc::calculateParallel(data, 3) == expected);
+        CHECK(Crc::calculateParallel(shortData, 2) == Crc::calculate(shortData));
+    }
+}
+#endif
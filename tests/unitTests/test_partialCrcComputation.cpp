@@ -47,6 +47,16 @@ TEST_CASE("CRC8 Partial computation") {
     }
 }
 
+TEST_CASE("CRC7 Partial computation") {
+    {
+        INFO("Checking CRC7");
+        auto part1Crc = CRC7<implementation>::calculatePartial(CRC7<implementation>::initialize(), testdataPart1);
+        auto part2Crc = CRC7<implementation>::calculatePartial(part1Crc, testdataPart2);
+        auto result = CRC7<implementation>::finalize(part2Crc);
+        CHECK(result == 0x30);
+    }
+}
+
 TEST_CASE("CRC16 Partial computation") {
     {
         INFO("Checking CRC16_CCITT");
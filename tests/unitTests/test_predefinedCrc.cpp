@@ -42,51 +42,61 @@ TEST_CASE("CRC8") {
         INFO("Checking CRC8_CCITT");
         auto result = CRC8_CCITT<implementation>::calculate(testdata);
         CHECK(result == 0x71);
+        CHECK(CRC8_CCITT<implementation>::calculate(testdata.data(), testdata.size()) == 0x71);
     }
     {
         INFO("Checking CRC8_CDMA2000, init value 0xFF");
         auto result = CRC8_CDMA2000<implementation>::calculate(testdata);
         CHECK(result == 0xF9);
+        CHECK(CRC8_CDMA2000<implementation>::calculate(testdata.data(), testdata.size()) == 0xF9);
     }
     {
         INFO("Checking CRC8_DARC");
         auto result = CRC8_DARC<implementation>::calculate(testdata);
         CHECK(result == 0x07);
+        CHECK(CRC8_DARC<implementation>::calculate(testdata.data(), testdata.size()) == 0x07);
     }
     {
         INFO("Checking CRC8_DVB_S2");
         auto result = CRC8_DVB_S2<implementation>::calculate(testdata);
         CHECK(result == 0x11);
+        CHECK(CRC8_DVB_S2<implementation>::calculate(testdata.data(), testdata.size()) == 0x11);
     }
     {
         INFO("Checking CRC8_EBU, init value 0xFF");
         auto result = CRC8_EBU<implementation>::calculate(testdata);
         CHECK(result == 0x4C);
+        CHECK(CRC8_EBU<implementation>::calculate(testdata.data(), testdata.size()) == 0x4C);
     }
     {
         INFO("Checking CRC8_I_CODE, init value 0xFD");
         auto result = CRC8_I_CODE<implementation>::calculate(testdata);
         CHECK(result == 0x3F);
+        CHECK(CRC8_I_CODE<implementation>::calculate(testdata.data(), testdata.size()) == 0x3F);
     }
     {
         INFO("Checking CRC8_ITU");
         auto result = CRC8_ITU<implementation>::calculate(testdata);
         CHECK(result == 0x24);
+        CHECK(CRC8_ITU<implementation>::calculate(testdata.data(), testdata.size()) == 0x24);
     }
     {
         INFO("Checking CRC8_MAXIM");
         auto result = CRC8_MAXIM<implementation>::calculate(testdata);
         CHECK(result == 0x82);
+        CHECK(CRC8_MAXIM<implementation>::calculate(testdata.data(), testdata.size()) == 0x82);
     }
     {
         INFO("Checking CRC8_ROHC, init value 0xFF");
         auto result = CRC8_ROHC<implementation>::calculate(testdata);
         CHECK(result == 0xB1);
+        CHECK(CRC8_ROHC<implementation>::calculate(testdata.data(), testdata.size()) == 0xB1);
     }
     {
         INFO("Checking CRC8_WCDMA");
         auto result = CRC8_WCDMA<implementation>::calculate(testdata);
         CHECK(result == 0xB2);
+        CHECK(CRC8_WCDMA<implementation>::calculate(testdata.data(), testdata.size()) == 0xB2);
     }
 }
 
@@ -95,116 +105,157 @@ TEST_CASE("CRC16") {
         INFO("Checking CRC16_CCITT");
         auto result = CRC16_CCITT<implementation>::calculate(testdata);
         CHECK(result == 0x7C8C);
+        CHECK(CRC16_CCITT<implementation>::calculate(testdata.data(), testdata.size()) == 0x7C8C);
     }
     {
         INFO("Checking CRC16_ARC");
         auto result = CRC16_ARC<implementation>::calculate(testdata);
         CHECK(result == 0x322A);
+        CHECK(CRC16_ARC<implementation>::calculate(testdata.data(), testdata.size()) == 0x322A);
     }
     {
         INFO("Checking CRC16_AUG_CCITT, init 0x1D0F");
         auto result = CRC16_AUG_CCITT<implementation>::calculate(testdata);
         CHECK(result == 0x8D03);
+        CHECK(CRC16_AUG_CCITT<implementation>::calculate(testdata.data(), testdata.size()) == 0x8D03);
     }
     {
         INFO("Checking CRC16_BUYPASS");
         auto result = CRC16_BUYPASS<implementation>::calculate(testdata);
         CHECK(result == 0x2913);
+        CHECK(CRC16_BUYPASS<implementation>::calculate(testdata.data(), testdata.size()) == 0x2913);
     }
     {
         INFO("Checking CRC16_CDMA2000");
         auto result = CRC16_CDMA2000<implementation>::calculate(testdata);
         CHECK(result == 0x6204);
+        CHECK(CRC16_CDMA2000<implementation>::calculate(testdata.data(), testdata.size()) == 0x6204);
     }
     {
         INFO("Checking CRC16_DDS_110");
         auto result = CRC16_DDS_110<implementation>::calculate(testdata);
         CHECK(result == 0x7BCC);
+        CHECK(CRC16_DDS_110<implementation>::calculate(testdata.data(), testdata.size()) == 0x7BCC);
     }
     {
         INFO("Checking CRC16_DECT_R");
         auto result = CRC16_DECT_R<implementation>::calculate(testdata);
         CHECK(result == 0xFD81);
+        CHECK(CRC16_DECT_R<implementation>::calculate(testdata.data(), testdata.size()) == 0xFD81);
     }
     {
         INFO("Checking CRC16_DECT_X");
         auto result = CRC16_DECT_X<implementation>::calculate(testdata);
         CHECK(result == 0xFD80);
+        CHECK(CRC16_DECT_X<implementation>::calculate(testdata.data(), testdata.size()) == 0xFD80);
     }
     {
         INFO("Checking CRC16_DNP");
         auto result = CRC16_DNP<implementation>::calculate(testdata);
         CHECK(result == 0xD288);
+        CHECK(CRC16_DNP<implementation>::calculate(testdata.data(), testdata.size()) == 0xD288);
     }
     {
         INFO("Checking CRC16_EN_13757");
         auto result = CRC16_EN_13757<implementation>::calculate(testdata);
         CHECK(result == 0x07E6);
+        CHECK(CRC16_EN_13757<implementation>::calculate(testdata.data(), testdata.size()) == 0x07E6);
     }
     {
         INFO("Checking CRC16_GENIBUS");
         auto result = CRC16_GENIBUS<implementation>::calculate(testdata);
         CHECK(result == 0x8373);
+        CHECK(CRC16_GENIBUS<implementation>::calculate(testdata.data(), testdata.size()) == 0x8373);
     }
     {
         INFO("Checking CRC16_MAXIM");
         auto result = CRC16_MAXIM<implementation>::calculate(testdata);
         CHECK(result == 0xCDD5);
+        CHECK(CRC16_MAXIM<implementation>::calculate(testdata.data(), testdata.size()) == 0xCDD5);
     }
     {
         INFO("Checking CRC16_MCRF4XX");
         auto result = CRC16_MCRF4XX<implementation>::calculate(testdata);
         CHECK(result == 0xA041);
+        CHECK(CRC16_MCRF4XX<implementation>::calculate(testdata.data(), testdata.size()) == 0xA041);
     }
     {
         INFO("Checking CRC16_RIELLO");
         auto result = CRC16_RIELLO<implementation>::calculate(testdata);
         CHECK(result == 0x908B);
+        CHECK(CRC16_RIELLO<implementation>::calculate(testdata.data(), testdata.size()) == 0x908B);
     }
     {
         INFO("Checking CRC16_T10_DIF");
         auto result = CRC16_T10_DIF<implementation>::calculate(testdata);
         CHECK(result == 0xE564);
+        CHECK(CRC16_T10_DIF<implementation>::calculate(testdata.data(), testdata.size()) == 0xE564);
     }
     {
         INFO("Checking CRC16_TELEDISK");
         auto result = CRC16_TELEDISK<implementation>::calculate(testdata);
         CHECK(result == 0x024C);
+        CHECK(CRC16_TELEDISK<implementation>::calculate(testdata.data(), testdata.size()) == 0x024C);
     }
     {
         INFO("Checking CRC16_TMS37157");
         auto result = CRC16_TMS37157<implementation>::calculate(testdata);
         CHECK(result == 0xAFCF);
+        CHECK(CRC16_TMS37157<implementation>::calculate(testdata.data(), testdata.size()) == 0xAFCF);
     }
     {
         INFO("Checking CRC16_USB");
         auto result = CRC16_USB<implementation>::calculate(testdata);
         CHECK(result == 0xD6CE);
+        CHECK(CRC16_USB<implementation>::calculate(testdata.data(), testdata.size()) == 0xD6CE);
     }
     {
         INFO("Checking CRC16_A");
         auto result = CRC16_A<implementation>::calculate(testdata);
         CHECK(result == 0x3074);
+        CHECK(CRC16_A<implementation>::calculate(testdata.data(), testdata.size()) == 0x3074);
     }
     {
         INFO("Checking CRC16_KERMIT");
         auto result = CRC16_KERMIT<implementation>::calculate(testdata);
         CHECK(result == 0x3BAD);
+        CHECK(CRC16_KERMIT<implementation>::calculate(testdata.data(), testdata.size()) == 0x3BAD);
     }
     {
         INFO("Checking CRC16_MODBUS");
         auto result = CRC16_MODBUS<implementation>::calculate(testdata);
         CHECK(result == 0x2931);
+        CHECK(CRC16_MODBUS<implementation>::calculate(testdata.data(), testdata.size()) == 0x2931);
     }
     {
         INFO("Checking CRC16_X_25");
         auto result = CRC16_X_25<implementation>::calculate(testdata);
         CHECK(result == 0x5FBE);
+        CHECK(CRC16_X_25<implementation>::calculate(testdata.data(), testdata.size()) == 0x5FBE);
     }
     {
         INFO("Checking CRC16_XMODEM");
         auto result = CRC16_XMODEM<implementation>::calculate(testdata);
         CHECK(result == 0x4B55);
+        CHECK(CRC16_XMODEM<implementation>::calculate(testdata.data(), testdata.size()) == 0x4B55);
+    }
+}
+
+TEST_CASE("CRC17") {
+    {
+        INFO("Checking CRC17_CAN");
+        auto result = CRC17_CAN<implementation>::calculate(testdata);
+        CHECK(result == 0x117CE);
+        CHECK(CRC17_CAN<implementation>::calculate(testdata.data(), testdata.size()) == 0x117CE);
+    }
+}
+
+TEST_CASE("CRC21") {
+    {
+        INFO("Checking CRC21_CAN");
+        auto result = CRC21_CAN<implementation>::calculate(testdata);
+        CHECK(result == 0x8324E);
+        CHECK(CRC21_CAN<implementation>::calculate(testdata.data(), testdata.size()) == 0x8324E);
     }
 }
 
@@ -213,40 +264,48 @@ TEST_CASE("CRC32") {
         INFO("Checking CRC32_BZIP2");
         auto result = CRC32_BZIP2<implementation>::calculate(testdata);
         CHECK(result == 0xF7AC52F1);
+        CHECK(CRC32_BZIP2<implementation>::calculate(testdata.data(), testdata.size()) == 0xF7AC52F1);
     }
     {
         INFO("Checking CRC32C");
         auto result = CRC32C<implementation>::calculate(testdata);
         CHECK(result == 0xE26FCA95);
+        CHECK(CRC32C<implementation>::calculate(testdata.data(), testdata.size()) == 0xE26FCA95);
     }
     {
         INFO("Checking CRC32D");
         auto result = CRC32D<implementation>::calculate(testdata);
         CHECK(result == 0x58CB70A9);
+        CHECK(CRC32D<implementation>::calculate(testdata.data(), testdata.size()) == 0x58CB70A9);
     }
     {
         INFO("Checking CRC32_MPEG_2");
         auto result = CRC32_MPEG_2<implementation>::calculate(testdata);
         CHECK(result == 0x0853AD0E);
+        CHECK(CRC32_MPEG_2<implementation>::calculate(testdata.data(), testdata.size()) == 0x0853AD0E);
     }
     {
         INFO("Checking CRC32_POSIX");
         auto result = CRC32_POSIX<implementation>::calculate(testdata);
         CHECK(result == 0xD9F08D8C);
+        CHECK(CRC32_POSIX<implementation>::calculate(testdata.data(), testdata.size()) == 0xD9F08D8C);
     }
     {
         INFO("Checking CRC32Q");
         auto result = CRC32Q<implementation>::calculate(testdata);
         CHECK(result == 0x0ED9B182);
+        CHECK(CRC32Q<implementation>::calculate(testdata.data(), testdata.size()) == 0x0ED9B182);
     }
     {
         INFO("Checking CRC32_JAMCRC");
         auto result = CRC32_JAMCRC<implementation>::calculate(testdata);
         CHECK(result == 0x81E1C7FD);
+        CHECK(CRC32_JAMCRC<implementation>::calculate(testdata.data(), testdata.size()) == 0x81E1C7FD);
     }
     {
         INFO("Checking CRC32_XFER");
         auto result = CRC32_XFER<implementation>::calculate(testdata);
         CHECK(result == 0xC54B7959);
+        CHECK(CRC32_XFER<implementation>::calculate(testdata.data(), testdata.size()) == 0xC54B7959);
     }
 }
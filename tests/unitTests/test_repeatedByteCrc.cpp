@@ -0,0 +1,98 @@
+/**
+ * @license    BSD 3-Clause
+ * @brief      CRC library
+ *
+ * @authors    Pawel Okas
+ *
+ * @copyright Copyright (c) 2021, Pawel Okas
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+ * following conditions are met:
+ *
+ *     1. Redistributions of source code must retain the above copyright notice, this list of conditions and the
+ * following disclaimer.
+ *     2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ * following disclaimer in the documentation and/or other materials provided with the distribution.
+ *     3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote
+ * products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include <vector>
+
+#include "doctest/doctest.h"
+#include "microhal-crc.hpp"
+
+using namespace microhal;
+
+constexpr auto implementation = Implementation::CRC_IMPLEMENTATION;
+
+TEST_CASE("CRC of repeated byte") {
+    {
+        INFO("Checking CRC7, 64 bytes 0xFF");
+        CHECK(CRC7<implementation>::calculateRepeated(0xFF, 64) == 0x77);
+    }
+    {
+        INFO("Checking CRC8_ROHC, 255 bytes 0x01");
+        CHECK(CRC8_ROHC<implementation>::calculateRepeated(0x01, 255) == 0x5E);
+    }
+    {
+        INFO("Checking CRC16_X_25, 1000 bytes 0xAA");
+        CHECK(CRC16_X_25<implementation>::calculateRepeated(0xAA, 1000) == 0xF11A);
+    }
+    {
+        INFO("Checking CRC21_CAN, 7 bytes 0xAA");
+        CHECK(CRC21_CAN<implementation>::calculateRepeated(0xAA, 7) == 0x0F0252);
+    }
+    {
+        // test vectors from RFC 3720 (iSCSI)
+        INFO("Checking CRC32C, 32 bytes 0x00 and 0xFF");
+        CHECK(CRC32C<implementation>::calculateRepeated(0x00, 32) == 0x8A9136AA);
+        CHECK(CRC32C<implementation>::calculateRepeated(0xFF, 32) == 0x62A8AB43);
+    }
+}
+
+TEST_CASE("CRC of repeated byte after prefix") {
+    constexpr std::array<uint8_t, 3> prefix = {0x01, 0x02, 0x03};
+    for (uint8_t byte : {0x00, 0xFF, 0xAA}) {
+        for (size_t count : {size_t{0}, size_t{1}, size_t{3}, size_t{255}, size_t{1000}}) {
+            const std::vector<uint8_t> data(count, byte);
+            {
+                INFO("Checking CRC3_GSM, byte: " << int{byte} << ", count: " << count);
+                using Crc = CRC3_GSM<implementation>;
+                const auto init = Crc::calculatePartial(Crc::initialize(), prefix);
+                CHECK(Crc::calculatePartialRepeated(init, byte, count) == Crc::calculatePartial(init, data));
+            }
+            {
+                INFO("Checking CRC16_CCITT, byte: " << int{byte} << ", count: " << count);
+                using Crc = CRC16_CCITT<implementation>;
+                const auto init = Crc::calculatePartial(Crc::initialize(), prefix);
+                CHECK(Crc::calculatePartialRepeated(init, byte, count) == Crc::calculatePartial(init, data));
+            }
+            {
+                INFO("Checking CRC32_XFER, byte: " << int{byte} << ", count: " << count);
+                using Crc = CRC32_XFER<implementation>;
+                const auto init = Crc::calculatePartial(Crc::initialize(), prefix);
+                CHECK(Crc::calculatePartialRepeated(init, byte, count) == Crc::calculatePartial(init, data));
+            }
+        }
+    }
+}
+
+TEST_CASE("CRC of long repeated byte run") {
+    // 1 GiB of erased flash calculated at compile time
+    constexpr uint64_t count = 1024 * 1024 * 1024;
+    using Crc = CRC32<implementation>;
+    static_assert(Crc::calculateRepeated(0xFF, 2 * count) ==
+                  Crc::combine(Crc::calculateRepeated(0xFF, count), Crc::calculateRepeated(0xFF, count), count));
+    constexpr std::array<uint8_t, 9> check = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+    static_assert(Crc::calculatePartialRepeated(Crc::calculatePartial(Crc::initialize(), check), 0xFF, 0) ==
+                  Crc::calculatePartial(Crc::initialize(), check));
+}
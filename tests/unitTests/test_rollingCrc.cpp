@@ -0,0 +1,141 @@
+/**
+ * @license    BSD 3-Clause
+ * @brief      CRC library
+ *
+ * @authors    Pawel Okas
+ *
+ * @copyright Copyright (c) 2021, Pawel Okas
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+ * following conditions are met:
+ *
+ *     1. Redistributions of source code must retain the above copyright notice, this list of conditions and the
+ * following disclaimer.
+ *     2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ * following disclaimer in the documentation and/or other materials provided with the distribution.
+ *     3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote
+ * products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <vector>
+
+#include "doctest/doctest.h"
+#include "microhal-crc.hpp"
+
+using namespace microhal;
+
+constexpr auto implementation = Implementation::CRC_IMPLEMENTATION;
+
+// rolls window over the whole stream and compares CRC of every window with CRC calculated from scratch
+template <typename Crc, size_t windowSize>
+void checkRolling() {
+    std::vector<uint8_t> data(600);
+    for (size_t i = 0; i < data.size(); i++) {
+        data[i] = uint8_t(i * 59 + (i >> 5));
+    }
+    const auto stream = std::span<const uint8_t>(data);
+    RollingCRC<Crc, windowSize> rolling(stream.first<windowSize>());
+    for (size_t start = 0; start + windowSize <= data.size(); start++) {
+        INFO("window: " << windowSize << ", start: " << start);
+        if (start > 0) rolling.roll(data[start - 1], data[start + windowSize - 1]);
+        CHECK(rolling.crc() == Crc::calculate(stream.subspan(start, windowSize)));
+    }
+}
+
+constexpr std::array<uint8_t, 10> data = {'0', '1', '2', '3', '4', '5', '6', '7', '8', '9'};
+
+TEST_CASE("Rolling CRC") {
+    // window "012345678" rolled by one byte becomes "123456789"
+    const auto stream = std::span<const uint8_t>(data);
+    {
+        INFO("Checking CRC5_USB");
+        RollingCRC<CRC5_USB<implementation>, 9> rolling(stream.first<9>());
+        rolling.roll(data[0], data[9]);
+        CHECK(rolling.crc() == 0x04);
+    }
+    {
+        INFO("Checking CRC7");
+        RollingCRC<CRC7<implementation>, 9> rolling(stream.first<9>());
+        rolling.roll(data[0], data[9]);
+        CHECK(rolling.crc() == 0x75);
+    }
+    {
+        INFO("Checking CRC8_MAXIM");
+        RollingCRC<CRC8_MAXIM<implementation>, 9> rolling(stream.first<9>());
+        rolling.roll(data[0], data[9]);
+        CHECK(rolling.crc() == 0xA1);
+    }
+    {
+        INFO("Checking CRC16_CCITT");
+        RollingCRC<CRC16_CCITT<implementation>, 9> rolling(stream.first<9>());
+        rolling.roll(data[0], data[9]);
+        CHECK(rolling.crc() == 0x29B1);
+    }
+    {
+        INFO("Checking CRC17_CAN");
+        RollingCRC<CRC17_CAN<implementation>, 9> rolling(stream.first<9>());
+        rolling.roll(data[0], data[9]);
+        CHECK(rolling.crc() == 0x04F03);
+    }
+    {
+        INFO("Checking CRC32");
+        RollingCRC<CRC32<implementation>, 9> rolling(stream.first<9>());
+        rolling.roll(data[0], data[9]);
+        CHECK(rolling.crc() == 0x89A1897F);
+    }
+    {
+        INFO("Checking CRC32C");
+        RollingCRC<CRC32C<implementation>, 9> rolling(stream.first<9>());
+        rolling.roll(data[0], data[9]);
+        CHECK(rolling.crc() == 0xE3069283);
+    }
+}
+
+TEST_CASE("Rolling CRC of long stream") {
+    {
+        INFO("Checking CRC7");
+        checkRolling<CRC7<implementation>, 1>();
+        checkRolling<CRC7<implementation>, 48>();
+    }
+    {
+        INFO("Checking CRC16_X_25");
+        checkRolling<CRC16_X_25<implementation>, 16>();
+        checkRolling<CRC16_X_25<implementation>, 512>();
+    }
+    {
+        INFO("Checking CRC32C");
+        checkRolling<CRC32C<implementation>, 1>();
+        checkRolling<CRC32C<implementation>, 16>();
+        checkRolling<CRC32C<implementation>, 48>();
+        checkRolling<CRC32C<implementation>, 512>();
+    }
+}
+
+TEST_CASE("Rolling CRC window size") {
+    using Rolling = RollingCRC<CRC32C<implementation>, 9>;
+    static_assert(std::is_constructible_v<Rolling, std::span<const uint8_t, 9>>);
+    static_assert(std::is_constructible_v<Rolling, const std::array<uint8_t, 9> &>);
+    static_assert(!std::is_constructible_v<Rolling, std::span<const uint8_t, 8>>);
+    static_assert(!std::is_constructible_v<Rolling, std::span<const uint8_t>>);
+}
+
+TEST_CASE("Rolling CRC at compile time") {
+    using Crc = CRC32C<implementation>;
+    constexpr auto crc = [] {
+        const auto stream = std::span<const uint8_t>(data);
+        RollingCRC<Crc, 9> rolling(stream.first<9>());
+        rolling.roll(data[0], data[9]);
+        return rolling.crc();
+    }();
+    static_assert(crc == Crc::calculate(std::span(data).last(9)));
+    static_assert(crc == 0xE3069283);
+}
@@ -91,3 +91,20 @@ TEST_CASE("Table 256 Reflected element generation for CRC16 CCITT") {
     }
     CHECK(crcTable == table);
 }
+
+TEST_CASE("Table 16 element generation for CRC16 CCITT") {
+    const std::array<uint16_t, 16> crcTable = {0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+                                               0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF};
+
+    auto table = crcDetail::tableGenerator16MSB<uint16_t>(0x1021, 16);
+    CHECK(crcTable == table);
+}
+
+TEST_CASE("Table 16 Reflected element generation for CRC32") {
+    const std::array<uint32_t, 16> crcTable = {0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4,
+                                               0x4DB26158, 0x5005713C, 0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C,
+                                               0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C};
+
+    auto table = crcDetail::tableGenerator16LSB<uint32_t>(0xEDB88320, 32);
+    CHECK(crcTable == table);
+}
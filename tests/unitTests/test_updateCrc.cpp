@@ -0,0 +1,136 @@
+/**
+ * @license    BSD 3-Clause
+ * @brief      CRC library
+ *
+ * @authors    Pawel Okas
+ *
+ * @copyright Copyright (c) 2021, Pawel Okas
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+ * following conditions are met:
+ *
+ *     1. Redistributions of source code must retain the above copyright notice, this list of conditions and the
+ * following disclaimer.
+ *     2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ * following disclaimer in the documentation and/or other materials provided with the distribution.
+ *     3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote
+ * products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <vector>
+
+#include "doctest/doctest.h"
+#include "microhal-crc.hpp"
+
+using namespace microhal;
+
+constexpr auto implementation = Implementation::CRC_IMPLEMENTATION;
+
+// patches bytes at several offsets of long record and compares updated CRC with CRC of patched record
+template <typename Crc>
+void checkUpdate() {
+    std::vector<uint8_t> record(3000);
+    for (size_t i = 0; i < record.size(); i++) {
+        record[i] = uint8_t(i * 31 + (i >> 7));
+    }
+    const auto oldCrc = Crc::calculate(record);
+    constexpr std::array<size_t, 6> offsets = {0, 1, 8, 1000, 2992, 2999};
+    constexpr std::array<size_t, 5> lengths = {0, 1, 2, 8, 100};
+    for (auto offset : offsets) {
+        for (auto length : lengths) {
+            length = std::min(length, record.size() - offset);
+            INFO("offset: " << offset << ", length: " << length);
+            std::vector<uint8_t> patched = record;
+            for (size_t i = offset; i < offset + length; i++) {
+                patched[i] = uint8_t(patched[i] ^ (i * 7 + 1));
+            }
+            const auto oldBytes = std::span<const uint8_t>(record).subspan(offset, length);
+            const auto newBytes = std::span<const uint8_t>(patched).subspan(offset, length);
+            CHECK(Crc::update(oldCrc, offset, oldBytes, newBytes, record.size()) == Crc::calculate(patched));
+        }
+    }
+}
+
+constexpr std::array<uint8_t, 9> check = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+constexpr std::array<uint8_t, 9> patchedCheck = {'1', '2', 'x', 'y', '5', '6', '7', '8', '9'};
+
+TEST_CASE("CRC update after modification") {
+    // "123456789" patched to "12xy56789"
+    const auto oldBytes = std::span<const uint8_t>(check).subspan(2, 2);
+    const auto newBytes = std::span<const uint8_t>(patchedCheck).subspan(2, 2);
+    {
+        INFO("Checking CRC3_GSM");
+        CHECK(CRC3_GSM<implementation>::update(0x3, 2, oldBytes, newBytes, check.size()) == 0x7);
+    }
+    {
+        INFO("Checking CRC7");
+        CHECK(CRC7<implementation>::update(0x75, 2, oldBytes, newBytes, check.size()) == 0x05);
+    }
+    {
+        INFO("Checking CRC8_CDMA2000");
+        CHECK(CRC8_CDMA2000<implementation>::update(0xDA, 2, oldBytes, newBytes, check.size()) == 0xB3);
+    }
+    {
+        INFO("Checking CRC16_ARC");
+        CHECK(CRC16_ARC<implementation>::update(0xBB3D, 2, oldBytes, newBytes, check.size()) == 0x62C9);
+    }
+    {
+        INFO("Checking CRC16_X_25");
+        CHECK(CRC16_X_25<implementation>::update(0x906E, 2, oldBytes, newBytes, check.size()) == 0x16E4);
+    }
+    {
+        INFO("Checking CRC21_CAN");
+        CHECK(CRC21_CAN<implementation>::update(0x0ED841, 2, oldBytes, newBytes, check.size()) == 0x174870);
+    }
+    {
+        INFO("Checking CRC32_MPEG_2");
+        CHECK(CRC32_MPEG_2<implementation>::update(0x0376E6E7, 2, oldBytes, newBytes, check.size()) == 0x4B739C31);
+    }
+    {
+        INFO("Checking CRC32C");
+        CHECK(CRC32C<implementation>::update(0xE3069283, 2, oldBytes, newBytes, check.size()) == 0x5C5E0268);
+    }
+}
+
+TEST_CASE("CRC update of long record") {
+    {
+        INFO("Checking CRC5_USB");
+        checkUpdate<CRC5_USB<implementation>>();
+    }
+    {
+        INFO("Checking CRC16_CCITT");
+        checkUpdate<CRC16_CCITT<implementation>>();
+    }
+    {
+        INFO("Checking CRC32C");
+        checkUpdate<CRC32C<implementation>>();
+    }
+}
+
+TEST_CASE("CRC update at compile time") {
+    using Crc = CRC32C<implementation>;
+    constexpr auto oldBytes = std::span<const uint8_t>(check).subspan(2, 2);
+    constexpr auto newBytes = std::span<const uint8_t>(patchedCheck).subspan(2, 2);
+    static_assert(Crc::update(Crc::calculate(check), 2, oldBytes, newBytes, check.size()) ==
+                  Crc::calculate(patchedCheck));
+}
+
+TEST_CASE("CRC update invalid parameters") {
+    using Crc = CRC32C<implementation>;
+    const auto crc = Crc::calculate(check.data(), check.size());
+    const auto bytes = std::span<const uint8_t>(check).first(2);
+    CHECK_THROWS_AS(Crc::update(crc, 0, bytes, bytes.first(1), check.size()), std::invalid_argument);
+    CHECK_THROWS_AS(Crc::update(crc, 8, bytes, bytes, check.size()), std::invalid_argument);
+    CHECK_THROWS_AS(Crc::update(crc, 10, bytes, bytes, check.size()), std::invalid_argument);
+    CHECK_THROWS_AS(Crc::update(crc, UINT64_MAX, bytes, bytes, check.size()), std::invalid_argument);
+    CHECK(Crc::update(crc, 7, bytes, bytes, check.size()) == crc);
+}
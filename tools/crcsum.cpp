@@ -0,0 +1,214 @@
+/**
+ * @license    BSD 3-Clause
+ * @brief      CRC library
+ *
+ * @authors    Pawel Okas
+ *
+ * @copyright Copyright (c) 2021, Pawel Okas
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+ * following conditions are met:
+ *
+ *     1. Redistributions of source code must retain the above copyright notice, this list of conditions and the
+ * following disclaimer.
+ *     2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ * following disclaimer in the documentation and/or other materials provided with the distribution.
+ *     3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote
+ * products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * microhal-crcsum calculates CRC of files with any predefined CRC of microhal-crc library and prints it in cksum
+ * format: decimal CRC, file size in bytes and file name. Regular files are memory mapped and calculated by many
+ * threads, standard input and other files are read sequentially.
+ */
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include "microhal-crc.hpp"
+
+using namespace microhal;
+
+namespace {
+
+struct Algorithm {
+    std::string_view name;
+    uint64_t (*initialize)();
+    uint64_t (*calculatePartial)(uint64_t remainder, std::span<const uint8_t> data);
+    uint64_t (*finalize)(uint64_t remainder);
+    uint64_t (*calculateParallel)(std::span<const uint8_t> data, size_t threadCount);
+};
+
+template <template <Implementation> class CRCType>
+constexpr Algorithm makeAlgorithm(std::string_view name) {
+    using Crc = CRCType<Implementation::Auto>;
+    using ChecksumType = decltype(Crc::initialize());
+    return {name, []() -> uint64_t { return Crc::initialize(); },
+            [](uint64_t remainder, std::span<const uint8_t> data) -> uint64_t {
+                return Crc::calculatePartial(ChecksumType(remainder), data);
+            },
+            [](uint64_t remainder) -> uint64_t { return Crc::finalize(ChecksumType(remainder)); },
+            [](std::span<const uint8_t> data, size_t threadCount) -> uint64_t {
+                return Crc::calculateParallel(data, threadCount);
+            }};
+}
+
+#define CRC_ALGORITHM(name) makeAlgorithm<name>(#name)
+
+constexpr std::array algorithms = {
+    CRC_ALGORITHM(CRC3_GSM),        CRC_ALGORITHM(CRC4_ITU),        CRC_ALGORITHM(CRC5_EPC),
+    CRC_ALGORITHM(CRC5_ITU),        CRC_ALGORITHM(CRC5_USB),        CRC_ALGORITHM(CRC7),
+    CRC_ALGORITHM(CRC7_MVB),        CRC_ALGORITHM(CRC8_CCITT),      CRC_ALGORITHM(CRC8_CDMA2000),
+    CRC_ALGORITHM(CRC8_DARC),       CRC_ALGORITHM(CRC8_DVB_S2),     CRC_ALGORITHM(CRC8_EBU),
+    CRC_ALGORITHM(CRC8_I_CODE),     CRC_ALGORITHM(CRC8_ITU),        CRC_ALGORITHM(CRC8_MAXIM),
+    CRC_ALGORITHM(CRC8_ROHC),       CRC_ALGORITHM(CRC8_WCDMA),      CRC_ALGORITHM(CRC16_CCITT),
+    CRC_ALGORITHM(CRC16_ARC),       CRC_ALGORITHM(CRC16_AUG_CCITT), CRC_ALGORITHM(CRC16_BUYPASS),
+    CRC_ALGORITHM(CRC16_DECT),      CRC_ALGORITHM(CRC16_CDMA2000),  CRC_ALGORITHM(CRC16_DDS_110),
+    CRC_ALGORITHM(CRC16_DECT_R),    CRC_ALGORITHM(CRC16_DECT_X),    CRC_ALGORITHM(CRC16_DNP),
+    CRC_ALGORITHM(CRC16_EN_13757),  CRC_ALGORITHM(CRC16_GENIBUS),   CRC_ALGORITHM(CRC16_MAXIM),
+    CRC_ALGORITHM(CRC16_MCRF4XX),   CRC_ALGORITHM(CRC16_RIELLO),    CRC_ALGORITHM(CRC16_T10_DIF),
+    CRC_ALGORITHM(CRC16_TELEDISK),  CRC_ALGORITHM(CRC16_TMS37157),  CRC_ALGORITHM(CRC16_USB),
+    CRC_ALGORITHM(CRC16_A),         CRC_ALGORITHM(CRC16_KERMIT),    CRC_ALGORITHM(CRC16_MODBUS),
+    CRC_ALGORITHM(CRC16_X_25),      CRC_ALGORITHM(CRC16_XMODEM),    CRC_ALGORITHM(CRC17_CAN),
+    CRC_ALGORITHM(CRC21_CAN),       CRC_ALGORITHM(CRC32),           CRC_ALGORITHM(CRC32_BZIP2),
+    CRC_ALGORITHM(CRC32C),          CRC_ALGORITHM(CRC32D),          CRC_ALGORITHM(CRC32_MPEG_2),
+    CRC_ALGORITHM(CRC32_POSIX),     CRC_ALGORITHM(CRC32Q),          CRC_ALGORITHM(CRC32_JAMCRC),
+    CRC_ALGORITHM(CRC32_XFER)};
+
+#undef CRC_ALGORITHM
+
+const Algorithm *findAlgorithm(std::string_view name) {
+    for (const auto &algorithm : algorithms) {
+        if (algorithm.name == name) return &algorithm;
+    }
+    return nullptr;
+}
+
+void printUsage() {
+    std::cout << "Usage: microhal-crcsum [-a ALGORITHM] [-j THREADS] [FILE]...\n"
+                 "Print CRC checksum and byte count of each FILE, with no FILE or when FILE is -, read standard "
+                 "input.\n\n"
+                 "  -a ALGORITHM  predefined CRC, default CRC32C\n"
+                 "  -j THREADS    number of threads used for every file, default number of hardware threads\n"
+                 "  -l            list available algorithms\n"
+                 "  -h            display this help\n";
+}
+
+struct Checksum {
+    uint64_t crc;
+    uint64_t size;
+};
+
+Checksum checksumStream(const Algorithm &algorithm, int fd) {
+    std::vector<uint8_t> buffer(1024 * 1024);
+    uint64_t remainder = algorithm.initialize();
+    uint64_t size = 0;
+    while (true) {
+        const ssize_t count = read(fd, buffer.data(), buffer.size());
+        if (count < 0) {
+            if (errno == EINTR) continue;
+            throw std::system_error(errno, std::generic_category());
+        }
+        if (count == 0) break;
+        remainder = algorithm.calculatePartial(remainder, std::span(buffer.data(), size_t(count)));
+        size += uint64_t(count);
+    }
+    return {algorithm.finalize(remainder), size};
+}
+
+// Regular files are mapped to memory and calculated by many threads, other files are read sequentially.
+Checksum checksumFile(const Algorithm &algorithm, int fd, size_t threadCount) {
+    struct stat status;
+    if (fstat(fd, &status) == 0 && S_ISREG(status.st_mode) && status.st_size > 0) {
+        const size_t size = size_t(status.st_size);
+        void *mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapping != MAP_FAILED) {
+            madvise(mapping, size, MADV_SEQUENTIAL);
+#if defined(MADV_HUGEPAGE)
+            madvise(mapping, size, MADV_HUGEPAGE);
+#endif
+            const uint64_t crc =
+                algorithm.calculateParallel(std::span(static_cast<const uint8_t *>(mapping), size), threadCount);
+            munmap(mapping, size);
+            return {crc, size};
+        }
+    }
+    return checksumStream(algorithm, fd);
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+    const Algorithm *algorithm = findAlgorithm("CRC32C");
+    size_t threadCount = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<std::string> files;
+    for (int i = 1; i < argc; i++) {
+        const std::string_view argument = argv[i];
+        if ((argument == "-a" || argument == "-j") && i + 1 == argc) {
+            std::cerr << "microhal-crcsum: option " << argument << " requires an argument\n";
+            return 1;
+        }
+        if (argument == "-a") {
+            algorithm = findAlgorithm(argv[++i]);
+            if (algorithm == nullptr) {
+                std::cerr << "microhal-crcsum: unknown algorithm " << argv[i] << ", use -l to list algorithms\n";
+                return 1;
+            }
+        } else if (argument == "-j") {
+            threadCount = std::max(1ul, std::strtoul(argv[++i], nullptr, 10));
+        } else if (argument == "-l") {
+            for (const auto &entry : algorithms) {
+                std::cout << entry.name << '\n';
+            }
+            return 0;
+        } else if (argument == "-h") {
+            printUsage();
+            return 0;
+        } else {
+            files.emplace_back(argument);
+        }
+    }
+    if (files.empty()) files.emplace_back("-");
+
+    int status = 0;
+    for (const auto &file : files) {
+        const bool standardInput = file == "-";
+        const int fd = standardInput ? STDIN_FILENO : open(file.c_str(), O_RDONLY);
+        if (fd < 0) {
+            std::cerr << "microhal-crcsum: " << file << ": " << std::strerror(errno) << '\n';
+            status = 1;
+            continue;
+        }
+        try {
+            const Checksum checksum = checksumFile(*algorithm, fd, threadCount);
+            std::cout << checksum.crc << ' ' << checksum.size;
+            if (!standardInput) std::cout << ' ' << file;
+            std::cout << '\n';
+        } catch (const std::system_error &error) {
+            std::cerr << "microhal-crcsum: " << file << ": " << error.code().message() << '\n';
+            status = 1;
+        }
+        if (!standardInput) close(fd);
+    }
+    return status;
+}
@@ -1,22 +1,43 @@
+import argparse
 import json
 import subprocess
+import sys
 import matplotlib.pyplot as plt
 import csv
 
+reportCRCs = ["CRC8_CCITT", "CRC8_DARC", "CRC16_CCITT", "CRC16_ARC", "CRC32", "CRC32C"]
+
 
 def runLatexToPDF(filename):
     subprocess.run(["pdflatex", "-synctex=1", "-interaction=nonstopmode ", filename])
 
 
+def runTest(binary, bytesPerMeasurement):
+    command = [binary]
+    if bytesPerMeasurement:
+        command += ["--bytes", str(bytesPerMeasurement)]
+    proc = subprocess.Popen(command, stdout=subprocess.PIPE)
+    stdout, stderr = proc.communicate()
+    return json.loads(stdout)
+
+
+def computeMetrics(result):
+    for crc in result['tests']:
+        for measurements in crc['implementation'].values():
+            for measurement in measurements:
+                measurement['MBps'] = measurement['size'] * 1000 / measurement['ns']
+                if 'cycles' in measurement:
+                    measurement['cyclesPerByte'] = measurement['cycles'] / measurement['size']
+
+
 def generateBarGraphPlotData(result):
+    # time of 1 MB calculation in ms, measured with the biggest message
     filedata = {}
-    for crc in result:
+    for crc in result['tests']:
         for impl in crc['implementation']:
             if impl not in filedata:
                 filedata[impl] = {}
-            filedata[impl][crc["CRC"]['name']] = crc['implementation'][impl] / 1000000
-    print(filedata)
-    print(filedata['BitShift'].keys())
+            filedata[impl][crc["CRC"]['name']] = 1000 / crc['implementation'][impl][-1]['MBps']
     with open('data.csv', 'w') as csvfile:
         writer = csv.DictWriter(csvfile, fieldnames=['implementation'] + list(filedata['BitShift'].keys()))
         writer.writeheader()
@@ -26,22 +47,87 @@ def generateBarGraphPlotData(result):
             writer.writerow(tmp)
 
 
+def generateThroughputCurves(result, crcNames):
+    for crc in result['tests']:
+        if crc['CRC']['name'] not in crcNames:
+            continue
+        plt.figure(figsize=(10, 6))
+        for impl, measurements in crc['implementation'].items():
+            plt.plot([m['size'] for m in measurements], [m['MBps'] for m in measurements], marker='.', label=impl)
+        plt.xscale('log', base=2)
+        plt.yscale('log')
+        plt.xlabel('message size [B]')
+        plt.ylabel('throughput [MB/s]')
+        plt.title(crc['CRC']['name'] + ', ' + result['platform']['cpu'] + ', ' + result['platform']['compiler'])
+        plt.legend(fontsize='small', ncol=2)
+        plt.grid(True, which='both', alpha=0.3)
+        plt.savefig('throughput_' + crc['CRC']['name'] + '.png', dpi=150)
+        plt.close()
+
+
+def compareWithBaseline(result, baseline, threshold):
+    for key in ['cpu', 'compiler', 'flags']:
+        if result['platform'][key] != baseline['platform'][key]:
+            print('Warning: ' + key + ' differs from baseline: "' + result['platform'][key] + '" vs "' +
+                  baseline['platform'][key] + '"')
+    baselineThroughput = {}
+    for crc in baseline['tests']:
+        for impl, measurements in crc['implementation'].items():
+            for measurement in measurements:
+                baselineThroughput[(crc['CRC']['name'], impl, measurement['size'])] = measurement['MBps']
+    regressions = []
+    for crc in result['tests']:
+        for impl, measurements in crc['implementation'].items():
+            for measurement in measurements:
+                key = (crc['CRC']['name'], impl, measurement['size'])
+                if key not in baselineThroughput:
+                    continue
+                change = (measurement['MBps'] / baselineThroughput[key] - 1) * 100
+                if change < -threshold:
+                    regressions.append((key, baselineThroughput[key], measurement['MBps'], change))
+    for (crc, impl, size), old, new, change in regressions:
+        print('Regression: {}/{} {} B: {:.1f} -> {:.1f} MB/s ({:.1f}%)'.format(crc, impl, size, old, new, change))
+    print('{} regressions above {}% threshold'.format(len(regressions), threshold))
+    return regressions
+
+
 def main():
-    proc = subprocess.Popen('../build/tests/multiplatformPerformance/multiplatformTest', stdout=subprocess.PIPE)
-    stdout, stderr = proc.communicate()
-    j = json.loads(stdout)
-    implementations = ["BitShift", "BitShiftLsb", "Table256", "Table256Lsb"]
-    result = {}
-    for crc in j:
-        for implementation in implementations:
-            if implementation not in result:
-                result[implementation] = {'x': [], 'y': []}
-            result[implementation]['x'].append(crc["CRC"]["polyLength"])
-            result[implementation]['y'].append(crc["implementation"][implementation])
-
-    print(j)
-    generateBarGraphPlotData(j)
-    runLatexToPDF('report.tex')
+    parser = argparse.ArgumentParser(description='Runs multiplatformTest and generates performance report')
+    parser.add_argument('--binary', default='../build/tests/multiplatformPerformance/multiplatformTest',
+                        help='path to multiplatformTest executable')
+    parser.add_argument('--bytes', type=int, help='bytes processed in every measurement, more gives stable results')
+    parser.add_argument('--input', help='use results saved in JSON file instead of running the test')
+    parser.add_argument('--output', help='save results with computed MB/s and cycles/byte, can be used as baseline')
+    parser.add_argument('--baseline', help='JSON file with baseline results')
+    parser.add_argument('--threshold', type=float, default=10.0,
+                        help='throughput drop in percent reported as regression, default 10')
+    parser.add_argument('--plot', nargs='*', default=reportCRCs, help='CRCs for which throughput curves are plotted')
+    parser.add_argument('--no-report', action='store_true', help="don't generate plots and PDF report")
+    args = parser.parse_args()
+
+    if args.input:
+        with open(args.input) as file:
+            result = json.load(file)
+    else:
+        result = runTest(args.binary, args.bytes)
+    computeMetrics(result)
+    print(json.dumps(result['platform']))
+
+    if args.output:
+        with open(args.output, 'w') as file:
+            json.dump(result, file, indent=1)
+
+    if not args.no_report:
+        generateBarGraphPlotData(result)
+        generateThroughputCurves(result, args.plot)
+        runLatexToPDF('report.tex')
+
+    if args.baseline:
+        with open(args.baseline) as file:
+            baseline = json.load(file)
+        computeMetrics(baseline)
+        if compareWithBaseline(result, baseline, args.threshold):
+            sys.exit(1)
 
 
 if __name__ == '__main__':